@@ -47,6 +47,10 @@ static void pd_zero_to_words(HeapWord* tohw, size_t count) {
   pd_fill_to_words(tohw, count, 0);
 }
 
+static void pd_zero_to_words_nontemporal(HeapWord* tohw, size_t count) {
+  pd_zero_to_words(tohw, count);
+}
+
 static void pd_zero_to_bytes(void* to, size_t count) {
   memset(to, 0, count);
 }
@@ -51,10 +51,33 @@ static void pd_fill_to_bytes(void* to, size_t count, jubyte value) {
   (void)memset(to, value, count);
 }
 
+#if defined(AMD64) && defined(__GNUC__)
+// Zeroing at least this many words bypasses the caches with non-temporal
+// stores.  Large cleared objects are unlikely to be read back soon, and
+// pulling them through the cache would evict the mutator's working set.
+const size_t NonTemporalZeroingWords = 512 * K / HeapWordSize;
+#endif
+
 static void pd_zero_to_words(HeapWord* tohw, size_t count) {
   pd_fill_to_words(tohw, count, 0);
 }
 
+static void pd_zero_to_words_nontemporal(HeapWord* tohw, size_t count) {
+#if defined(AMD64) && defined(__GNUC__)
+  if (count >= NonTemporalZeroingWords) {
+    julong* to = (julong*) tohw;
+    for (size_t i = 0; i < count; i++) {
+      __asm__ volatile ("movnti %1, %0" : "=m" (to[i]) : "r" ((julong)0));
+    }
+    // Non-temporal stores are weakly ordered; make them visible before
+    // any later (e.g. header publishing) stores.
+    __asm__ volatile ("sfence" : : : "memory");
+    return;
+  }
+#endif
+  pd_fill_to_words(tohw, count, 0);
+}
+
 static void pd_zero_to_bytes(void* to, size_t count) {
   (void)memset(to, 0, count);
 }
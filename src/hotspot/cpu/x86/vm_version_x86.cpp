@@ -1707,6 +1707,13 @@ void VM_Version::get_processor_features() {
     }
   }
 #endif // !PRODUCT
+  if (UseAVX > 2) {
+    // Report which intrinsics use 512-bit vectors. Bulk copy, inflate and
+    // fill switch to them at AVX3Threshold; short compare-style operations
+    // stay at 256 bits unless the threshold is zero.
+    log_info(os, cpu)("AVX-512 intrinsics: copy, inflate and fill from %d bytes, compare operations %s",
+                      AVX3Threshold, AVX3Threshold == 0 ? "512-bit" : "256-bit");
+  }
   if (FLAG_IS_DEFAULT(UseSignumIntrinsic)) {
       FLAG_SET_DEFAULT(UseSignumIntrinsic, true);
   }
@@ -50,6 +50,10 @@
   product(bool, UseTransparentHugePages, false,                         \
           "Use MADV_HUGEPAGE for large pages")                          \
                                                                         \
+  product(bool, UseTransparentHugePagesForCode, false,                  \
+          "Use MADV_HUGEPAGE for executable memory such as the code "   \
+          "cache, independently of UseTransparentHugePages")            \
+                                                                        \
   product(bool, LoadExecStackDllInVMThread, true,                       \
           "Load DLLs with executable-stack attribute in the VM Thread") \
                                                                         \
@@ -82,7 +86,13 @@
           "Use CPU_ALLOC code path in os::active_processor_count ")     \
                                                                         \
   product(bool, DumpPerfMapAtExit, false, DIAGNOSTIC,                   \
-          "Write map file for Linux perf tool at exit")
+          "Write map file for Linux perf tool at exit")                 \
+                                                                        \
+  product(uintx, TrimNativeHeapInterval, 0, EXPERIMENTAL,               \
+          "Interval, in ms, at which the service thread returns free "  \
+          "C-heap memory to the OS with malloc_trim (glibc only). "     \
+          "0 disables periodic trimming.")                              \
+          range(0, max_jint)
 
 // end of RUNTIME_OS_FLAGS
 
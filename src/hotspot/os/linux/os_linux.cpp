@@ -2206,6 +2206,81 @@ void os::Linux::print_process_memory_info(outputStream* st) {
 
 }
 
+static size_t get_rss_bytes() {
+  ssize_t vmrss = -1;
+  FILE* f = ::fopen("/proc/self/status", "r");
+  if (f != NULL) {
+    char buf[256];
+    while (::fgets(buf, sizeof(buf), f) != NULL) {
+      if (sscanf(buf, "VmRSS: " SSIZE_FORMAT " kB", &vmrss) == 1) {
+        break;
+      }
+    }
+    fclose(f);
+  }
+  return vmrss > 0 ? (size_t)vmrss * K : 0;
+}
+
+bool os::Linux::trim_native_heap(size_t* rss_before, size_t* rss_after) {
+#ifdef __GLIBC__
+  *rss_before = get_rss_bytes();
+  ::malloc_trim(0);
+  *rss_after = get_rss_bytes();
+  return true;
+#else
+  return false;
+#endif // __GLIBC__
+}
+
+static bool _native_heap_trim_started = false;
+static jlong _last_native_heap_trim = 0;
+
+bool os::Linux::should_trim_native_heap() {
+  if (TrimNativeHeapInterval == 0) {
+    return false;
+  }
+  // Use the monotonic clock so that wall-clock adjustments do not skew the interval.
+  jlong now = os::javaTimeNanos();
+  if (!_native_heap_trim_started) {
+    _native_heap_trim_started = true;
+    _last_native_heap_trim = now;
+    return false;
+  }
+  if (now - _last_native_heap_trim < (jlong)TrimNativeHeapInterval * NANOSECS_PER_MILLISEC) {
+    return false;
+  }
+  _last_native_heap_trim = now;
+  return true;
+}
+
+bool os::Linux::print_native_heap_info(outputStream* st) {
+#ifdef __GLIBC__
+  if (_mallinfo2 != NULL) {
+    struct glibc_mallinfo2 mi = _mallinfo2();
+    st->print_cr("C-Heap: arena " SIZE_FORMAT "K, mmapped " SIZE_FORMAT "K, "
+                 "in use " SIZE_FORMAT "K, free " SIZE_FORMAT "K, trimmable " SIZE_FORMAT "K",
+                 mi.arena / K, mi.hblkhd / K, mi.uordblks / K, mi.fordblks / K, mi.keepcost / K);
+  }
+  // malloc_info writes one <heap> element per arena.
+  char* buf = NULL;
+  size_t len = 0;
+  FILE* f = ::open_memstream(&buf, &len);
+  if (f == NULL) {
+    return false;
+  }
+  int ret = ::malloc_info(0, f);
+  fclose(f);
+  if (ret == 0 && buf != NULL) {
+    st->print_raw(buf, len);
+    st->cr();
+  }
+  ::free(buf);
+  return ret == 0;
+#else
+  return false;
+#endif // __GLIBC__
+}
+
 bool os::Linux::print_ld_preload_file(outputStream* st) {
   return _print_ascii_file("/etc/ld.so.preload", st, "/etc/ld.so.preload:");
 }
@@ -2710,6 +2785,11 @@ static void warn_fail_commit_memory(char* addr, size_t size,
 //       All it does is to check if there are enough free pages
 //       left at the time of mmap(). This could be a potential
 //       problem.
+// Define MADV_HUGEPAGE here so we can build HotSpot on old systems.
+#ifndef MADV_HUGEPAGE
+  #define MADV_HUGEPAGE 14
+#endif
+
 int os::Linux::commit_memory_impl(char* addr, size_t size, bool exec) {
   int prot = exec ? PROT_READ|PROT_WRITE|PROT_EXEC : PROT_READ|PROT_WRITE;
   uintptr_t res = (uintptr_t) ::mmap(addr, size, prot,
@@ -2718,6 +2798,10 @@ int os::Linux::commit_memory_impl(char* addr, size_t size, bool exec) {
     if (UseNUMAInterleaving) {
       numa_make_global(addr, size);
     }
+    if (exec && UseTransparentHugePagesForCode && !UseTransparentHugePages) {
+      // Only a hint: THP may be disabled or the range too small to be backed.
+      ::madvise(addr, size, MADV_HUGEPAGE);
+    }
     return 0;
   }
 
@@ -2760,11 +2844,6 @@ void os::pd_commit_memory_or_exit(char* addr, size_t size, bool exec,
   #define MAP_HUGE_SHIFT 26
 #endif
 
-// Define MADV_HUGEPAGE here so we can build HotSpot on old systems.
-#ifndef MADV_HUGEPAGE
-  #define MADV_HUGEPAGE 14
-#endif
-
 int os::Linux::commit_memory_impl(char* addr, size_t size,
                                   size_t alignment_hint, bool exec) {
   int err = os::Linux::commit_memory_impl(addr, size, exec);
@@ -2810,6 +2889,36 @@ void os::pd_free_memory(char *addr, size_t bytes, size_t alignment_hint) {
   }
 }
 
+// Define MADV_POPULATE_WRITE here so we can build HotSpot on old systems.
+// It is supported by kernels since 5.14.
+#ifndef MADV_POPULATE_WRITE
+  #define MADV_POPULATE_WRITE 23
+#endif
+
+static volatile bool _populate_write_unsupported = false;
+
+bool os::pd_pretouch_memory(void* start, void* end, size_t page_size) {
+  if (Atomic::load(&_populate_write_unsupported)) {
+    return false;
+  }
+  char* first = align_down((char*)start, os::vm_page_size());
+  char* last = align_up((char*)end, os::vm_page_size());
+  if (first >= last) {
+    return true;
+  }
+  // Let the kernel fault in the whole range in one call, which also gives
+  // it a chance to allocate transparent huge pages directly.
+  if (::madvise(first, last - first, MADV_POPULATE_WRITE) == 0) {
+    return true;
+  }
+  if (errno == EINVAL) {
+    // Not supported by this kernel; don't try again.
+    log_debug(os)("MADV_POPULATE_WRITE not supported, pretouching by touching pages");
+    Atomic::store(&_populate_write_unsupported, true);
+  }
+  return false;
+}
+
 void os::numa_make_global(char *addr, size_t bytes) {
   Linux::numa_interleave_memory(addr, bytes);
 }
@@ -3489,8 +3598,46 @@ bool os::unguard_memory(char* addr, size_t size) {
   return linux_mprotect(addr, size, PROT_READ|PROT_WRITE);
 }
 
+// Read the selected mode, shown in brackets, from one of the
+// /sys/kernel/mm/transparent_hugepage control files.
+static bool read_thp_mode(const char* path, char* mode, size_t mode_len) {
+  char buf[256];
+  FILE* f = fopen(path, "r");
+  if (f == NULL) {
+    return false;
+  }
+  char* line = fgets(buf, sizeof(buf), f);
+  fclose(f);
+  if (line == NULL) {
+    return false;
+  }
+  char* start = strchr(buf, '[');
+  char* end = (start != NULL) ? strchr(start, ']') : NULL;
+  if (end == NULL) {
+    return false;
+  }
+  os::snprintf(mode, mode_len, "%.*s", (int)(end - start - 1), start + 1);
+  return true;
+}
+
 bool os::Linux::transparent_huge_pages_sanity_check(bool warn,
                                                     size_t page_size) {
+  char enabled[32];
+  char defrag[32];
+  if (read_thp_mode("/sys/kernel/mm/transparent_hugepage/enabled", enabled, sizeof(enabled))) {
+    if (!read_thp_mode("/sys/kernel/mm/transparent_hugepage/defrag", defrag, sizeof(defrag))) {
+      os::snprintf(defrag, sizeof(defrag), "unknown");
+    }
+    log_info(pagesize)("Transparent huge pages: enabled=%s, defrag=%s", enabled, defrag);
+    if (strcmp(enabled, "never") == 0) {
+      // madvise(MADV_HUGEPAGE) still succeeds, but no huge pages are used.
+      if (warn) {
+        warning("TransparentHugePages is disabled by the operating system (mode \"never\").");
+      }
+      return false;
+    }
+  }
+
   bool result = false;
   void *p = mmap(NULL, page_size * 2, PROT_READ|PROT_WRITE,
                  MAP_ANONYMOUS|MAP_PRIVATE,
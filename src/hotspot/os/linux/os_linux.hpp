@@ -297,6 +297,16 @@ class Linux {
     return _numa_tonode_memory != NULL ? _numa_tonode_memory(start, size, node) : -1;
   }
 
+  // Return free C-heap memory to the OS with glibc malloc_trim. Returns
+  // false if this is not supported by the C library. The resident set size
+  // before and after trimming is returned in bytes. Callers that are Java
+  // threads should be in native state, since trimming can take a while.
+  static bool trim_native_heap(size_t* rss_before, size_t* rss_after);
+  // Has TrimNativeHeapInterval elapsed since the last periodic trim?
+  static bool should_trim_native_heap();
+  // Print glibc malloc statistics, including the per-arena breakdown.
+  static bool print_native_heap_info(outputStream* st);
+
   static bool is_running_in_interleave_mode() {
     return _current_numa_policy == Interleave;
   }
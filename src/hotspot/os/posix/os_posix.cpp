@@ -44,6 +44,7 @@
 #include "runtime/java.hpp"
 #include "runtime/orderAccess.hpp"
 #include "runtime/perfMemory.hpp"
+#include "runtime/safepointMechanism.inline.hpp"
 #include "utilities/align.hpp"
 #include "utilities/events.hpp"
 #include "utilities/formatBuffer.hpp"
@@ -1594,7 +1595,7 @@ void os::PlatformEvent::unpark() {
 
 // JSR166 support
 
- os::PlatformParker::PlatformParker() : _counter(0), _cur_index(-1) {
+ os::PlatformParker::PlatformParker() : _counter(0), _cur_index(-1), _spin_limit(ParkSpinLimit) {
   int status = pthread_cond_init(&_cond[REL_INDEX], _condAttr);
   assert_status(status == 0, status, "cond_init rel");
   status = pthread_cond_init(&_cond[ABS_INDEX], NULL);
@@ -1643,6 +1644,38 @@ void Parker::park(bool isAbsolute, jlong time) {
     to_abstime(&absTime, time, isAbsolute, false);
   }
 
+  // Spin briefly for a permit before blocking. In hand-off patterns the
+  // unpark often arrives within a few microseconds, and catching it here
+  // avoids the thread state transitions and the condvar wait. The spin
+  // length grows while spinning pays off and shrinks when it does not,
+  // but never below a small floor so that it can recover. The thread is
+  // still _thread_in_vm here, so stop as soon as a safepoint or handshake
+  // is pending, and never spin past the requested timeout.
+  if (ParkSpinLimit > 0) {
+    const int min_spin = MIN2(16, (int)ParkSpinLimit);
+    const jlong spin_start = (time > 0 && !isAbsolute) ? os::javaTimeNanos() : 0;
+    bool timed_out = false;
+    for (int i = 0; i < _spin_limit; i++) {
+      SpinPause();
+      if (Atomic::load(&_counter) > 0 && Atomic::xchg(&_counter, 0) > 0) {
+        _spin_limit = MIN2(_spin_limit * 2, (int)ParkSpinLimit);
+        return;
+      }
+      if (SafepointMechanism::should_process(jt)) {
+        break;
+      }
+      if (time > 0 && (isAbsolute ? os::javaTimeMillis() >= time
+                                  : os::javaTimeNanos() - spin_start >= time)) {
+        timed_out = true;
+        break;
+      }
+    }
+    _spin_limit = MAX2(_spin_limit / 2, min_spin);
+    if (timed_out) {
+      return;
+    }
+  }
+
   // Enter safepoint region
   // Beware of deadlocks such as 6317397.
   // The per-thread Parker:: mutex is a classic leaf-lock.
@@ -174,6 +174,7 @@ class PlatformParker {
   };
   volatile int _counter;
   int _cur_index;  // which cond is in use: -1, 0, 1
+  int _spin_limit; // current adaptive spin length, see ParkSpinLimit
   pthread_mutex_t _mutex[1];
   pthread_cond_t  _cond[2]; // one for relative times and one for absolute
 
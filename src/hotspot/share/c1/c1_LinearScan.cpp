@@ -86,6 +86,7 @@ LinearScan::LinearScan(IR* ir, LIRGenerator* gen, FrameMap* frame_map)
  , _new_intervals_from_allocation(NULL)
  , _sorted_intervals(NULL)
  , _needs_full_resort(false)
+ , _fast_split(false)
  , _lir_ops(0)     // initialized later with correct length
  , _block_of_op(0) // initialized later with correct length
  , _has_info(0)
@@ -3092,6 +3093,11 @@ void LinearScan::do_linear_scan() {
 
   number_instructions();
 
+  // Profiled code is short-lived, so for huge methods compile latency
+  // matters more than the number of spill moves.
+  _fast_split = C1FastSplitThreshold > 0 && compilation()->is_profiling() &&
+                _lir_ops.length() >= C1FastSplitThreshold;
+
   NOT_PRODUCT(print_lir(1, "Before Register Allocation"));
 
   compute_local_live_sets();
@@ -5138,6 +5144,11 @@ int LinearScanWalker::find_optimal_split_pos(Interval* it, int min_split_pos, in
     TRACE_LINEAR_SCAN(4, tty->print_cr("      min-pos and max-pos are equal, no optimization possible"));
     optimal_split_pos = min_split_pos;
 
+  } else if (allocator()->fast_split()) {
+    // don't search for a block boundary, split as late as possible
+    TRACE_LINEAR_SCAN(4, tty->print_cr("      fast split mode, splitting at max_split_pos"));
+    optimal_split_pos = max_split_pos;
+
   } else {
     assert(min_split_pos < max_split_pos, "must be true then");
     assert(min_split_pos > 0, "cannot access min_split_pos - 1 otherwise");
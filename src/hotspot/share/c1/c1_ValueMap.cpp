@@ -380,6 +380,10 @@ void LoopInvariantCodeMotion::process_block(BlockBegin* block) {
       LoadField* lf = (LoadField*)cur;
       // deoptimizes on NullPointerException
       cur_invariant = !lf->needs_patching() && !lf->field()->is_volatile() && !_short_loop_optimizer->has_field_store(lf->field()->type()->basic_type()) && is_invariant(lf->obj()) && _insert_is_pred;
+    } else if (cur->as_NullCheck() != NULL) {
+      NullCheck* nc = cur->as_NullCheck();
+      // deoptimizes on NullPointerException
+      cur_invariant = nc->can_trap() && is_invariant(nc->obj()) && _insert_is_pred;
     } else if (cur->as_ArrayLength() != NULL) {
       ArrayLength *length = cur->as_ArrayLength();
       cur_invariant = is_invariant(length->array());
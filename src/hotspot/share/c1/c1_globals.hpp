@@ -328,6 +328,12 @@
   product(bool, C1UpdateMethodData, true,                                   \
           "Update MethodData*s in Tier1-generated code")                    \
                                                                             \
+  product(intx, C1FastSplitThreshold, 0,                                    \
+          "For profiled (tier 2 and 3) compilations with at least this "    \
+          "many LIR operations, split intervals where needed instead of "   \
+          "searching for the best block boundary. 0 disables it")           \
+          range(0, max_jint)                                                \
+                                                                            \
   develop(bool, PrintCFGToFile, false,                                      \
           "print control flow graph to a separate file during compilation")
 
@@ -117,6 +117,11 @@ bool Dictionary::resize_if_needed() {
   int desired_size = 0;
   if (_needs_resizing == true) {
     desired_size = calculate_resize(false);
+    if (desired_size == table_size()) {
+      // The small table sizes are exhausted. Continue with the large
+      // ones so that loaders with very many classes keep short chains.
+      desired_size = calculate_resize(true);
+    }
     assert(desired_size != 0, "bug in calculate_resize");
     if (desired_size == table_size()) {
       _resizable = false; // hit max
@@ -379,24 +379,29 @@ oop StringTable::do_intern(Handle string_or_null_h, const jchar* name,
 
 // Concurrent work
 void StringTable::grow(JavaThread* jt) {
-  StringTableHash::GrowTask gt(_local_table);
-  if (!gt.prepare(jt)) {
-    return;
-  }
-  log_trace(stringtable)("Started to grow");
-  {
-    TraceTime timer("Grow", TRACETIME_LOG(Debug, stringtable, perf));
-    while (gt.do_task(jt)) {
-      gt.pause(jt);
-      {
-        ThreadBlockInVM tbivm(jt);
+  // Keep doubling until the load factor is acceptable again. A burst of
+  // inserts can overshoot by several doublings, and waiting for a new
+  // concurrent work request after each one keeps long chains around.
+  do {
+    StringTableHash::GrowTask gt(_local_table);
+    if (!gt.prepare(jt)) {
+      return;
+    }
+    log_trace(stringtable)("Started to grow");
+    {
+      TraceTime timer("Grow", TRACETIME_LOG(Debug, stringtable, perf));
+      while (gt.do_task(jt)) {
+        gt.pause(jt);
+        {
+          ThreadBlockInVM tbivm(jt);
+        }
+        gt.cont(jt);
       }
-      gt.cont(jt);
     }
-  }
-  gt.done(jt);
-  _current_size = table_size();
-  log_debug(stringtable)("Grown to size:" SIZE_FORMAT, _current_size);
+    gt.done(jt);
+    _current_size = table_size();
+    log_debug(stringtable)("Grown to size:" SIZE_FORMAT, _current_size);
+  } while (get_load_factor() > PREF_AVG_LIST_LEN && !_local_table->is_max_size_reached());
 }
 
 struct StringTableDoDelete : StackObj {
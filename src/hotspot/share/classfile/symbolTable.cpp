@@ -532,6 +532,14 @@ void SymbolTable::print_table_statistics(outputStream* st,
                                          const char* table_name) {
   SizeFunc sz;
   _local_table->statistics_to(Thread::current(), sz, st, table_name);
+  if (_arena != NULL) {
+    size_t arena_bytes;
+    {
+      MutexLocker ml(SymbolArena_lock, Mutex::_no_safepoint_check_flag);
+      arena_bytes = _arena->size_in_bytes();
+    }
+    st->print_cr("Permanent symbol arena: " SIZE_FORMAT " bytes", arena_bytes);
+  }
 }
 
 // Verification
@@ -637,24 +645,29 @@ void SymbolTable::serialize_shared_table_header(SerializeClosure* soc,
 
 // Concurrent work
 void SymbolTable::grow(JavaThread* jt) {
-  SymbolTableHash::GrowTask gt(_local_table);
-  if (!gt.prepare(jt)) {
-    return;
-  }
-  log_trace(symboltable)("Started to grow");
-  {
-    TraceTime timer("Grow", TRACETIME_LOG(Debug, symboltable, perf));
-    while (gt.do_task(jt)) {
-      gt.pause(jt);
-      {
-        ThreadBlockInVM tbivm(jt);
+  // Keep doubling until the load factor is acceptable again. A burst of
+  // inserts can overshoot by several doublings, and waiting for a new
+  // concurrent work request after each one keeps long chains around.
+  do {
+    SymbolTableHash::GrowTask gt(_local_table);
+    if (!gt.prepare(jt)) {
+      return;
+    }
+    log_trace(symboltable)("Started to grow");
+    {
+      TraceTime timer("Grow", TRACETIME_LOG(Debug, symboltable, perf));
+      while (gt.do_task(jt)) {
+        gt.pause(jt);
+        {
+          ThreadBlockInVM tbivm(jt);
+        }
+        gt.cont(jt);
       }
-      gt.cont(jt);
     }
-  }
-  gt.done(jt);
-  _current_size = table_size();
-  log_debug(symboltable)("Grown to size:" SIZE_FORMAT, _current_size);
+    gt.done(jt);
+    _current_size = table_size();
+    log_debug(symboltable)("Grown to size:" SIZE_FORMAT, _current_size);
+  } while (get_load_factor() > PREF_AVG_LIST_LEN && !_local_table->is_max_size_reached());
 }
 
 struct SymbolTableDoDelete : StackObj {
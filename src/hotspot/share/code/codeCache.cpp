@@ -1161,15 +1161,17 @@ int CodeCache::mark_for_deoptimization(Method* dependee) {
   return number_of_marked_CodeBlobs;
 }
 
-void CodeCache::make_marked_nmethods_not_entrant() {
+int CodeCache::make_marked_nmethods_not_entrant() {
   assert_locked_or_safepoint(CodeCache_lock);
+  int made_not_entrant = 0;
   CompiledMethodIterator iter(CompiledMethodIterator::only_alive_and_not_unloading);
   while(iter.next()) {
     CompiledMethod* nm = iter.method();
-    if (nm->is_marked_for_deoptimization()) {
-      nm->make_not_entrant();
+    if (nm->is_marked_for_deoptimization() && nm->make_not_entrant()) {
+      made_not_entrant++;
     }
   }
+  return made_not_entrant;
 }
 
 // Flushes compiled methods dependent on dependee.
@@ -27,19 +27,23 @@
 #include "compiler/compilationPolicy.hpp"
 #include "compiler/compileBroker.hpp"
 #include "compiler/compilerOracle.hpp"
+#include "compiler/hotMethodList.hpp"
 #include "memory/resourceArea.hpp"
 #include "oops/methodData.hpp"
 #include "oops/method.inline.hpp"
 #include "oops/oop.inline.hpp"
 #include "prims/jvmtiExport.hpp"
 #include "runtime/arguments.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/deoptimization.hpp"
 #include "runtime/frame.hpp"
 #include "runtime/frame.inline.hpp"
 #include "runtime/globals_extension.hpp"
 #include "runtime/handles.inline.hpp"
+#include "runtime/os_perf.hpp"
 #include "runtime/safepoint.hpp"
 #include "runtime/safepointVerifiers.hpp"
+#include "runtime/task.hpp"
 
 #if INCLUDE_JVMCI
 #include "jvmci/jvmci.hpp"
@@ -57,6 +61,8 @@ jlong CompilationPolicy::_start_time = 0;
 int CompilationPolicy::_c1_count = 0;
 int CompilationPolicy::_c2_count = 0;
 double CompilationPolicy::_increase_threshold_at_ratio = 0;
+volatile double CompilationPolicy::_load_scale = 1.0;
+CPUPerformanceInterface* CompilationPolicy::_cpu_perf = NULL;
 
 void compilationPolicy_init() {
   CompilationPolicy::initialize();
@@ -320,11 +326,51 @@ double CompilationPolicy::threshold_scale(CompLevel level, int feedback_k) {
         k *= exp(current_reverse_free_ratio - _increase_threshold_at_ratio);
       }
     }
+    if (TieredCPULoadFeedback && level == CompLevel_full_optimization) {
+      k *= cpu_load_scale();
+    }
     return k;
   }
   return 1;
 }
 
+// Make C2 compiles eager while the VM leaves its processors idle and back
+// them off when it saturates them. The load r is the CPU time used by this
+// process per processor available to the VM, so it follows the container
+// CPU quota and is not affected by other processes on the host. The
+// thresholds are scaled by 0.5 + r, clamped to [0.5, 2].
+//
+// Reading the load goes through /proc and CPUPerformanceInterface is not
+// thread-safe, so it is sampled every 100 ms by a periodic task on the
+// WatcherThread. The policy only reads the cached scale.
+class CPULoadSamplerTask : public PeriodicTask {
+  enum { SampleInterval = 100 };         // sampling interval in ms
+
+ public:
+  CPULoadSamplerTask() : PeriodicTask(SampleInterval) {}
+  void task() {
+    CompilationPolicy::sample_cpu_load();
+  }
+};
+
+void CompilationPolicy::sample_cpu_load() {
+  double process_load;
+  if (_cpu_perf->cpu_load_total_process(&process_load) == OS_OK) {
+    // process_load is relative to all processors on the host.
+    double r = process_load * os::processor_count() / os::active_processor_count();
+    double scale = clamp(0.5 + r, 0.5, 2.0);
+    if (PrintTieredEvents && fabs(scale - Atomic::load(&_load_scale)) > 0.25) {
+      ttyLocker tty_lock;
+      tty->print_cr("%lf: [process cpu load %.2lf, C2 threshold scale %.2lf]", os::elapsedTime(), r, scale);
+    }
+    Atomic::store(&_load_scale, scale);
+  }
+}
+
+double CompilationPolicy::cpu_load_scale() {
+  return Atomic::load(&_load_scale);
+}
+
 void CompilationPolicy::print_counters(const char* prefix, const Method* m) {
   int invocation_count = m->invocation_count();
   int backedge_count = m->backedge_count();
@@ -489,6 +535,15 @@ void CompilationPolicy::initialize() {
     }
     assert(count == c1_count() + c2_count(), "inconsistent compiler thread count");
     set_increase_threshold_at_ratio();
+    if (TieredCPULoadFeedback) {
+      _cpu_perf = new CPUPerformanceInterface();
+      if (_cpu_perf->initialize()) {
+        (new CPULoadSamplerTask())->enroll();
+      } else {
+        delete _cpu_perf;
+        _cpu_perf = NULL;
+      }
+    }
   }
   set_start_time(nanos_to_millis(os::javaTimeNanos()));
 }
@@ -609,6 +664,68 @@ void CompilationPolicy::handle_counter_overflow(Method* method) {
   }
 }
 
+// Called with the queue locked. Finds the coldest droppable tasks in one pass
+// over the queue and drops them together.
+void CompilationPolicy::trim_compile_queue(CompileQueue* compile_queue, CompileTask* keep, CompileTask* keep_blocking) {
+  int excess = compile_queue->size() - (int)TieredCompileQueueBacklogLimit;
+  if (excess <= 0) {
+    return;
+  }
+
+  // The candidates are kept in a heap with the hottest of them at the root,
+  // which is the one replaced when a colder task is found.
+  ResourceMark rm;
+  CompileTask** coldest = NEW_RESOURCE_ARRAY(CompileTask*, excess);
+  int n = 0;
+  for (CompileTask* task = compile_queue->first(); task != NULL; task = task->next()) {
+    if (task == keep || task == keep_blocking || task->is_blocking() ||
+        !task->can_become_stale() || is_old(task->method())) {
+      continue;
+    }
+    int i;
+    if (n < excess) {
+      // Sift up from the new last slot.
+      i = n++;
+      while (i > 0) {
+        int parent = (i - 1) / 2;
+        if (!compare_methods(task->method(), coldest[parent]->method())) {
+          break;
+        }
+        coldest[i] = coldest[parent];
+        i = parent;
+      }
+    } else if (compare_methods(coldest[0]->method(), task->method())) {
+      // Replace the root and sift down.
+      i = 0;
+      while (true) {
+        int child = 2 * i + 1;
+        if (child >= n) {
+          break;
+        }
+        if (child + 1 < n && compare_methods(coldest[child + 1]->method(), coldest[child]->method())) {
+          child++;
+        }
+        if (!compare_methods(coldest[child]->method(), task->method())) {
+          break;
+        }
+        coldest[i] = coldest[child];
+        i = child;
+      }
+    } else {
+      continue;
+    }
+    coldest[i] = task;
+  }
+
+  for (int i = 0; i < n; i++) {
+    CompileTask* task = coldest[i];
+    if (PrintTieredEvents) {
+      print_event(REMOVE_FROM_QUEUE, task->method(), task->method(), task->osr_bci(), (CompLevel) task->comp_level());
+    }
+    compile_queue->remove_and_mark_dropped(task);
+  }
+}
+
 // Called with the queue locked and with at least one element
 CompileTask* CompilationPolicy::select_task(CompileQueue* compile_queue) {
   CompileTask *max_blocking_task = NULL;
@@ -649,6 +766,13 @@ CompileTask* CompilationPolicy::select_task(CompileQueue* compile_queue) {
     task = next_task;
   }
 
+  // Keep the queue within the backlog limit by dropping the tasks of the
+  // coldest methods. The rates were just updated above, so methods that
+  // stopped being used since they were queued have decayed already.
+  if (TieredCompileQueueBacklogLimit > 0) {
+    trim_compile_queue(compile_queue, max_task, max_blocking_task);
+  }
+
   if (max_blocking_task != NULL) {
     // In blocking compilation mode, the CompileBroker will make
     // compilations submitted by a JVMCI compiler thread non-blocking. These
@@ -1010,6 +1134,10 @@ CompLevel CompilationPolicy::common(const methodHandle& method, CompLevel cur_le
         // If we were at full profile level, would we switch to full opt?
         if (common<Predicate>(method, CompLevel_full_profile, disable_feedback) == CompLevel_full_optimization) {
           next_level = CompLevel_full_optimization;
+        } else if (HotMethodList::is_hot(method())) {
+          // The method reached C2 in the run that produced the hot method list,
+          // start collecting the full profile right away.
+          next_level = CompilationModeFlag::disable_intermediate() ? CompLevel_full_optimization : CompLevel_full_profile;
         } else if (!CompilationModeFlag::disable_intermediate() && Predicate::apply(i, b, cur_level, method)) {
           // C1-generated fully profiled code is about 30% slower than the limited profile
           // code that has only invocation and backedge counters. The observation is that
@@ -32,6 +32,7 @@
 
 class CompileTask;
 class CompileQueue;
+class CPUPerformanceInterface;
 /*
  *  The system supports 5 execution levels:
  *  * level 0 - interpreter
@@ -163,10 +164,13 @@ class CompileQueue;
 class CompilationPolicy : AllStatic {
   friend class CallPredicate;
   friend class LoopPredicate;
+  friend class CPULoadSamplerTask;
 
   static jlong _start_time;
   static int _c1_count, _c2_count;
   static double _increase_threshold_at_ratio;
+  static volatile double _load_scale;
+  static CPUPerformanceInterface* _cpu_perf;
 
   // Set carry flags in the counters (in Method* and MDO).
   inline static void handle_counter_overflow(Method* method);
@@ -196,11 +200,18 @@ class CompilationPolicy : AllStatic {
   inline static double weight(Method* method);
   // Apply heuristics and return true if x should be compiled before y
   inline static bool compare_methods(Method* x, Method* y);
+  // Drop the tasks of the coldest methods so that the queue stays within
+  // TieredCompileQueueBacklogLimit. The given tasks are never dropped.
+  static void trim_compile_queue(CompileQueue* compile_queue, CompileTask* keep, CompileTask* keep_blocking);
   // Compute event rate for a given method. The rate is the number of event (invocations + backedges)
   // per millisecond.
   inline static void update_rate(jlong t, Method* m);
   // Compute threshold scaling coefficient
   inline static double threshold_scale(CompLevel level, int feedback_k);
+  // Scale for C2 thresholds from the process CPU load, see TieredCPULoadFeedback.
+  static double cpu_load_scale();
+  // Update the cached scale; called periodically by CPULoadSamplerTask.
+  static void sample_cpu_load();
   // If a method is old enough and is still in the interpreter we would want to
   // start profiling without waiting for the compiled method to arrive. This function
   // determines whether we should do that.
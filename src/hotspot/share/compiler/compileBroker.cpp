@@ -532,6 +532,15 @@ void CompileQueue::remove_and_mark_stale(CompileTask* task) {
   _first_stale = task;
 }
 
+// Drop a task to keep the queue within TieredCompileQueueBacklogLimit.
+// The task is reclaimed like a stale one.
+void CompileQueue::remove_and_mark_dropped(CompileTask* task) {
+  assert(MethodCompileQueue_lock->owned_by_self(), "must own lock");
+  task->method()->clear_queued_for_compilation();
+  remove_and_mark_stale(task);
+  _total_dropped++;
+}
+
 // methods in the compile queue need to be marked as used on the stack
 // so that they don't get reclaimed by Redefine Classes
 void CompileQueue::mark_on_stack() {
@@ -568,6 +577,9 @@ void CompileBroker::print_compile_queues(outputStream* st) {
 void CompileQueue::print(outputStream* st) {
   assert_locked_or_safepoint(MethodCompileQueue_lock);
   st->print_cr("%s:", name());
+  if (_total_dropped > 0) {
+    st->print_cr("Dropped tasks: %d", _total_dropped);
+  }
   CompileTask* task = _first;
   if (task == NULL) {
     st->print_cr("Empty");
@@ -1067,15 +1079,22 @@ void CompileBroker::possibly_add_compiler_threads(JavaThread* THREAD) {
   size_t available_cc_np  = CodeCache::unallocated_capacity(CodeBlobType::MethodNonProfiled),
          available_cc_p   = CodeCache::unallocated_capacity(CodeBlobType::MethodProfiled);
 
+  // Compiler threads must not crowd out the application. The processor count
+  // is re-read here since a container CPU quota can change at runtime.
+  int cpu_limit = MAX2(1, (int)(os::active_processor_count() * DynamicCompilerThreadsCPUPercent / 100));
+
   // Only do attempt to start additional threads if the lock is free.
   if (!CompileThread_lock->try_lock()) return;
 
+  int c1_active = (_c1_compile_queue != NULL) ? _compilers[0]->num_compiler_threads() : 0;
+
   if (_c2_compile_queue != NULL) {
     int old_c2_count = _compilers[1]->num_compiler_threads();
     int new_c2_count = MIN4(_c2_count,
         _c2_compile_queue->size() / 2,
         (int)(available_memory / (200*M)),
         (int)(available_cc_np / (128*K)));
+    new_c2_count = MIN2(new_c2_count, MAX2(1, cpu_limit - c1_active));
 
     for (int i = old_c2_count; i < new_c2_count; i++) {
 #if INCLUDE_JVMCI
@@ -1130,6 +1149,8 @@ void CompileBroker::possibly_add_compiler_threads(JavaThread* THREAD) {
         _c1_compile_queue->size() / 4,
         (int)(available_memory / (100*M)),
         (int)(available_cc_p / (128*K)));
+    int c2_active = (_c2_compile_queue != NULL) ? _compilers[1]->num_compiler_threads() : 0;
+    new_c1_count = MIN2(new_c1_count, MAX2(1, cpu_limit - c2_active));
 
     for (int i = old_c1_count; i < new_c1_count; i++) {
       JavaThread *ct = make_thread(compiler_t, compiler1_object(i), _c1_compile_queue, _compilers[0], THREAD);
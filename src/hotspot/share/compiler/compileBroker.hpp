@@ -89,6 +89,7 @@ class CompileQueue : public CHeapObj<mtCompiler> {
   CompileTask* _first_stale;
 
   int _size;
+  int _total_dropped;
 
   void purge_stale_tasks();
  public:
@@ -97,6 +98,7 @@ class CompileQueue : public CHeapObj<mtCompiler> {
     _first = NULL;
     _last = NULL;
     _size = 0;
+    _total_dropped = 0;
     _first_stale = NULL;
   }
 
@@ -105,6 +107,7 @@ class CompileQueue : public CHeapObj<mtCompiler> {
   void         add(CompileTask* task);
   void         remove(CompileTask* task);
   void         remove_and_mark_stale(CompileTask* task);
+  void         remove_and_mark_dropped(CompileTask* task);
   CompileTask* first()                           { return _first; }
   CompileTask* last()                            { return _last;  }
 
@@ -112,6 +115,7 @@ class CompileQueue : public CHeapObj<mtCompiler> {
 
   bool         is_empty() const                  { return _first == NULL; }
   int          size()     const                  { return _size;          }
+  int          total_dropped() const             { return _total_dropped; }
 
 
   // Redefine Classes support
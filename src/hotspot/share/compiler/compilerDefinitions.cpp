@@ -488,6 +488,12 @@ bool CompilerConfig::check_args_consistency(bool status) {
     }
     FLAG_SET_CMDLINE(PostLoopMultiversioning, false);
   }
+  if (UseMaskedPostLoop && !RangeCheckElimination) {
+    if (!FLAG_IS_DEFAULT(UseMaskedPostLoop)) {
+      warning("UseMaskedPostLoop disabled because RangeCheckElimination is disabled.");
+    }
+    FLAG_SET_CMDLINE(UseMaskedPostLoop, false);
+  }
 #endif // COMPILER2
 
   if (CompilerConfig::is_interpreter_only()) {
@@ -233,11 +233,22 @@
           "reaches this amount per compiler thread")                        \
           range(0, max_jint)                                                \
                                                                             \
+  product(bool, TieredCPULoadFeedback, false,                               \
+          "Scale tier 4 thresholds with the CPU load of this process per "  \
+          "available processor: lower while the VM leaves its processors "  \
+          "idle, higher while it saturates them")                           \
+                                                                            \
   product(intx, TieredCompileTaskTimeout, 50,                               \
           "Kill compile task if method was not used within "                \
           "given timeout in milliseconds")                                  \
           range(0, max_intx)                                                \
                                                                             \
+  product(intx, TieredCompileQueueBacklogLimit, 0,                          \
+          "Maximum number of tasks kept in a tiered compile queue. When "   \
+          "exceeded, the tasks of the coldest methods are dropped. "        \
+          "0 means no limit")                                               \
+          range(0, max_jint)                                                \
+                                                                            \
   product(intx, TieredStopAtLevel, 4,                                       \
           "Stop at given compilation level")                                \
           range(0, 4)                                                       \
@@ -307,6 +318,13 @@
           "File containing inlining replay information"                     \
           "[default: ./inline_pid%p.log] (%p replaced with pid)")           \
                                                                             \
+  product(ccstr, HotMethodListAtExit, NULL, EXPERIMENTAL,                   \
+          "At exit, write the methods compiled by C2 to this file")         \
+                                                                            \
+  product(ccstr, HotMethodListFile, NULL, EXPERIMENTAL,                     \
+          "Hot method list written by HotMethodListAtExit; methods "        \
+          "listed in it skip the tier 3 thresholds")                        \
+                                                                            \
   develop(intx, ReplaySuppressInitializers, 2,                              \
           "Control handling of class initialization during replay: "        \
           "0 - don't do anything special; "                                 \
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "classfile/symbolTable.hpp"
+#include "classfile/systemDictionary.hpp"
+#include "compiler/compilerDefinitions.hpp"
+#include "compiler/compiler_globals.hpp"
+#include "compiler/hotMethodList.hpp"
+#include "logging/log.hpp"
+#include "memory/resourceArea.hpp"
+#include "oops/method.hpp"
+#include "oops/symbol.hpp"
+#include "utilities/ostream.hpp"
+#include "utilities/resourceHash.hpp"
+
+class HotMethodListKey {
+ public:
+  Symbol* _klass;
+  Symbol* _name;
+  Symbol* _signature;
+
+  HotMethodListKey(Symbol* klass, Symbol* name, Symbol* signature) :
+    _klass(klass), _name(name), _signature(signature) {}
+
+  static unsigned hash(const HotMethodListKey& k) {
+    return k._klass->identity_hash() ^ (k._name->identity_hash() * 31) ^ (k._signature->identity_hash() * 961);
+  }
+
+  static bool equals(const HotMethodListKey& a, const HotMethodListKey& b) {
+    return a._klass == b._klass && a._name == b._name && a._signature == b._signature;
+  }
+};
+
+typedef ResourceHashtable<HotMethodListKey, bool,
+                          HotMethodListKey::hash, HotMethodListKey::equals,
+                          1009, ResourceObj::C_HEAP, mtCompiler> HotMethodListTable;
+
+static HotMethodListTable* _table = NULL;
+static stringStream* _dump_stream = NULL;
+
+// Can the symbol be written as a single field that load() reads back?
+static bool is_valid_field(const char* s) {
+  return strlen(s) <= HotMethodList::MaxFieldLength && strpbrk(s, " \t\r\n\v\f") == NULL;
+}
+
+static void dump_method(Method* m) {
+  if (m->is_method_handle_intrinsic() || m->highest_comp_level() != CompLevel_full_optimization) {
+    return;
+  }
+  ResourceMark rm;
+  const char* klass = m->klass_name()->as_C_string();
+  const char* name = m->name()->as_C_string();
+  const char* signature = m->signature()->as_C_string();
+  if (!is_valid_field(klass) || !is_valid_field(name) || !is_valid_field(signature)) {
+    return;
+  }
+  _dump_stream->print("%s %s %s", klass, name, signature);
+  _dump_stream->cr();
+}
+
+void HotMethodList::dump(outputStream* st) {
+  ResourceMark rm;
+  // Collect the list first: methods_do holds ClassLoaderDataGraph_lock,
+  // and st may be a file.
+  stringStream buffer;
+  _dump_stream = &buffer;
+  SystemDictionary::methods_do(dump_method);
+  _dump_stream = NULL;
+  st->write(buffer.base(), buffer.size());
+}
+
+bool HotMethodList::dump_to_file(const char* path) {
+  fileStream fs(path, "w");
+  if (!fs.is_open()) {
+    return false;
+  }
+  dump(&fs);
+  return true;
+}
+
+void HotMethodList::dump_at_exit() {
+  if (HotMethodListAtExit == NULL) {
+    return;
+  }
+  if (!dump_to_file(HotMethodListAtExit)) {
+    warning("Cannot open hot method list file %s", HotMethodListAtExit);
+  }
+}
+
+void HotMethodList::load() {
+  if (HotMethodListFile == NULL) {
+    return;
+  }
+  FILE* stream = fopen(HotMethodListFile, "rt");
+  if (stream == NULL) {
+    warning("Cannot open hot method list file %s", HotMethodListFile);
+    return;
+  }
+  _table = new (ResourceObj::C_HEAP, mtCompiler) HotMethodListTable();
+
+  STATIC_ASSERT(MaxFieldLength == 1023); // Matches the sscanf format below.
+  char line[3 * (MaxFieldLength + 1) + 1];
+  char klass[MaxFieldLength + 1];
+  char name[MaxFieldLength + 1];
+  char signature[MaxFieldLength + 1];
+  int count = 0;
+  int line_no = 0;
+  while (fgets(line, sizeof(line), stream) != NULL) {
+    line_no++;
+    size_t len = strlen(line);
+    if (len > 0 && line[len - 1] != '\n' && !feof(stream)) {
+      // Longer than any valid entry; skip the rest of it.
+      int c;
+      while ((c = fgetc(stream)) != EOF && c != '\n') {}
+      warning("%s:%d: malformed hot method list entry ignored", HotMethodListFile, line_no);
+      continue;
+    }
+    int end = 0;
+    int fields = sscanf(line, "%1023s %1023s %1023s %n", klass, name, signature, &end);
+    if (fields == EOF) {
+      continue; // Blank line.
+    }
+    if (fields != 3 || line[end] != '\0') {
+      warning("%s:%d: malformed hot method list entry ignored", HotMethodListFile, line_no);
+      continue;
+    }
+    HotMethodListKey key(SymbolTable::new_permanent_symbol(klass),
+                           SymbolTable::new_permanent_symbol(name),
+                           SymbolTable::new_permanent_symbol(signature));
+    if (_table->put(key, true)) {
+      count++;
+    }
+  }
+  fclose(stream);
+  log_info(jit, compilation)("Loaded %d hot methods from %s", count, HotMethodListFile);
+}
+
+bool HotMethodList::is_hot(const Method* m) {
+  if (_table == NULL) {
+    return false;
+  }
+  HotMethodListKey key(m->klass_name(), m->name(), m->signature());
+  return _table->get(key) != NULL;
+}
+
+void hotMethodList_init() {
+  HotMethodList::load();
+}
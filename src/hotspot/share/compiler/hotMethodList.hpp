@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_COMPILER_HOTMETHODLIST_HPP
+#define SHARE_COMPILER_HOTMETHODLIST_HPP
+
+#include "memory/allocation.hpp"
+
+class Method;
+class outputStream;
+
+// A hot method list records the methods that reached C2 during a run. A
+// later run can load the list as a warm-up hint: the compilation policy
+// moves listed methods to fully profiled code immediately instead of
+// waiting for the tier 3 thresholds. The list is written at exit with
+// HotMethodListAtExit, or on demand with the Compiler.hot_methods
+// diagnostic command.
+//
+// Only method identity is recorded. Counters and MethodData contents are
+// not persisted, so invocation counts and type and branch profiles are
+// rebuilt as usual in the new run.
+//
+// File format, one method per line:
+//   <klass> <method name> <signature>
+// Methods with whitespace in any of the fields, or with fields longer than
+// MaxFieldLength, are not written. Malformed lines are skipped on load.
+class HotMethodList : AllStatic {
+ public:
+  static const size_t MaxFieldLength = 1023;
+
+  // Write the list of hot methods currently loaded.
+  static void dump(outputStream* st);
+  // Write the list to the given file. Returns false if it cannot be opened.
+  static bool dump_to_file(const char* path);
+  // Write the list to HotMethodListAtExit, if set.
+  static void dump_at_exit();
+
+  // Read HotMethodListFile, if set.
+  static void load();
+  // Was the method hot in the run that produced the list?
+  static bool is_hot(const Method* m);
+};
+
+void hotMethodList_init();
+
+#endif // SHARE_COMPILER_HOTMETHODLIST_HPP
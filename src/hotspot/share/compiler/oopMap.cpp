@@ -201,10 +201,9 @@ void OopMapSet::add_gc_map(int pc_offset, OopMap *map ) {
     if (last->offset() == map->offset() ) {
       fatal("OopMap inserted twice");
     }
-    if (last->offset() > map->offset()) {
-      tty->print_cr( "WARNING, maps not sorted: pc[%d]=%d, pc[%d]=%d",
-                      _list.length(),last->offset(),_list.length()+1,map->offset());
-    }
+    // ImmutableOopMapSet::find_map_at_offset does a binary search.
+    assert(last->offset() < map->offset(), "maps not sorted: pc[%d]=%d, pc[%d]=%d",
+           _list.length(), last->offset(), _list.length() + 1, map->offset());
   }
 #endif // ASSERT
 
@@ -511,12 +510,23 @@ const ImmutableOopMap* ImmutableOopMapSet::find_map_at_offset(int pc_offset) con
   ImmutableOopMapPair* pairs = get_pairs();
   ImmutableOopMapPair* last  = NULL;
 
-  for (int i = 0; i < _count; ++i) {
-    if (pairs[i].pc_offset() >= pc_offset) {
-      last = &pairs[i];
-      break;
+  // The pairs are sorted by pc offset (see OopMapSet::add_gc_map), so
+  // binary search for the first pair at or after pc_offset. Stack walks
+  // do this for every compiled frame, and large nmethods have hundreds
+  // of maps.
+  int lo = 0;
+  int hi = _count;
+  while (lo < hi) {
+    int mid = lo + (hi - lo) / 2;
+    if (pairs[mid].pc_offset() < pc_offset) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
     }
   }
+  if (lo < _count) {
+    last = &pairs[lo];
+  }
 
   // Heal Coverity issue: potential index out of bounds access.
   guarantee(last != NULL, "last may not be null");
@@ -616,6 +626,12 @@ void ImmutableOopMapBuilder::fill(ImmutableOopMapSet* set, int sz) {
     ImmutableOopMapPair* pair = NULL;
     int size = 0;
 
+    // ImmutableOopMapSet::find_map_at_offset does a binary search, so
+    // the pairs must be strictly increasing in pc offset.
+    guarantee(i == 0 || pairs[i - 1].pc_offset() < map->offset(),
+              "oop maps not sorted: pc[%d]=%d, pc[%d]=%d",
+              i - 1, pairs[i - 1].pc_offset(), i, map->offset());
+
     if (_mapping[i]._kind == Mapping::OOPMAP_NEW) {
       size = fill_map(&pairs[i], map, _mapping[i]._offset, set);
     } else if (_mapping[i]._kind == Mapping::OOPMAP_DUPLICATE || _mapping[i]._kind == Mapping::OOPMAP_EMPTY) {
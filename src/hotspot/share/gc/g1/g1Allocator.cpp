@@ -287,10 +287,12 @@ G1PLABAllocator::G1PLABAllocator(G1Allocator* allocator) :
   _allocator(allocator) {
   for (region_type_t state = 0; state < G1HeapRegionAttr::Num; state++) {
     _direct_allocated[state] = 0;
+    _cur_desired_plab_size[state] = _g1h->desired_plab_sz(state);
+    _num_plab_fills[state] = 0;
     uint length = alloc_buffers_length(state);
     _alloc_buffers[state] = NEW_C_HEAP_ARRAY(PLAB*, length, mtGC);
     for (uint node_index = 0; node_index < length; node_index++) {
-      _alloc_buffers[state][node_index] = new PLAB(_g1h->desired_plab_sz(state));
+      _alloc_buffers[state][node_index] = new PLAB(_cur_desired_plab_size[state]);
     }
   }
 }
@@ -309,11 +311,23 @@ bool G1PLABAllocator::may_throw_away_buffer(size_t const allocation_word_sz, siz
   return (allocation_word_sz * 100 < buffer_size * ParallelGCBufferWastePct);
 }
 
+void G1PLABAllocator::update_plab_size(region_type_t dest) {
+  _num_plab_fills[dest]++;
+  // With -XX:-ResizePLAB the PLAB sizes given on the command line are fixed.
+  if (!ResizePLAB || _num_plab_fills[dest] % PLABRefillsBeforeResize != 0) {
+    return;
+  }
+  size_t const new_size = MIN2(_cur_desired_plab_size[dest] * 2, PLAB::max_size());
+  if (!G1CollectedHeap::is_humongous(new_size)) {
+    _cur_desired_plab_size[dest] = new_size;
+  }
+}
+
 HeapWord* G1PLABAllocator::allocate_direct_or_new_plab(G1HeapRegionAttr dest,
                                                        size_t word_sz,
                                                        bool* plab_refill_failed,
                                                        uint node_index) {
-  size_t plab_word_size = _g1h->desired_plab_sz(dest);
+  size_t plab_word_size = _cur_desired_plab_size[dest.type()];
   size_t required_in_plab = PLAB::size_required_for_allocation(word_sz);
 
   // Only get a new PLAB if the allocation fits and it would not waste more than
@@ -337,6 +351,7 @@ HeapWord* G1PLABAllocator::allocate_direct_or_new_plab(G1HeapRegionAttr dest,
 
     if (buf != NULL) {
       alloc_buf->set_buf(buf, actual_plab_size);
+      update_plab_size(dest.type());
 
       HeapWord* const obj = alloc_buf->allocate(word_sz);
       assert(obj != NULL, "PLAB should have been big enough, tried to allocate "
@@ -399,6 +414,14 @@ size_t G1PLABAllocator::undo_waste() const {
   return result;
 }
 
+size_t G1PLABAllocator::num_plab_fills() const {
+  size_t result = 0;
+  for (region_type_t state = 0; state < G1HeapRegionAttr::Num; state++) {
+    result += _num_plab_fills[state];
+  }
+  return result;
+}
+
 G1ArchiveAllocator* G1ArchiveAllocator::create_allocator(G1CollectedHeap* g1h, bool open) {
   return new G1ArchiveAllocator(g1h, open);
 }
@@ -161,7 +161,18 @@ private:
   // Number of words allocated directly (not counting PLAB allocation).
   size_t _direct_allocated[G1HeapRegionAttr::Num];
 
+  // PLAB size used by this allocator. Starts out with the size derived from
+  // the global statistics and grows if this worker refills often during the
+  // current pause, so that busy workers do not keep taking the refill path.
+  size_t _cur_desired_plab_size[G1HeapRegionAttr::Num];
+  // Number of PLAB refills during the current pause.
+  size_t _num_plab_fills[G1HeapRegionAttr::Num];
+
+  // Number of refills at the current size after which the PLAB size is doubled.
+  static const size_t PLABRefillsBeforeResize = 8;
+
   void flush_and_retire_stats();
+  void update_plab_size(region_type_t dest);
   inline PLAB* alloc_buffer(G1HeapRegionAttr dest, uint node_index) const;
   inline PLAB* alloc_buffer(region_type_t dest, uint node_index) const;
 
@@ -177,6 +188,8 @@ public:
 
   size_t waste() const;
   size_t undo_waste() const;
+  size_t num_plab_fills() const;
+  size_t plab_size(region_type_t dest) const { return _cur_desired_plab_size[dest]; }
 
   // Allocate word_sz words in dest, either directly into the regions or by
   // allocating a new PLAB. Returns the address of the allocated memory, NULL if
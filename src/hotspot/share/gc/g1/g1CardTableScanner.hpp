@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_G1_G1CARDTABLESCANNER_HPP
+#define SHARE_GC_G1_G1CARDTABLESCANNER_HPP
+
+#include "gc/g1/g1CardTable.hpp"
+#include "memory/allocation.hpp"
+#include "utilities/align.hpp"
+#include "utilities/count_leading_zeros.hpp"
+#include "utilities/count_trailing_zeros.hpp"
+#include "utilities/debug.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+// Helper class to scan and detect ranges of cards that need to be scanned on the
+// card table.
+class G1CardTableScanner : public StackObj {
+public:
+  typedef CardTable::CardValue CardValue;
+
+private:
+  CardValue* const _base_addr;
+
+  CardValue* _cur_addr;
+  CardValue* const _end_addr;
+
+  static const size_t ToScanMask = G1CardTable::g1_card_already_scanned;
+  static const size_t ExpandedToScanMask = G1CardTable::WordAlreadyScanned;
+
+  bool cur_addr_aligned() const {
+    return ((uintptr_t)_cur_addr) % sizeof(size_t) == 0;
+  }
+
+  bool cur_card_is_dirty() const {
+    CardValue value = *_cur_addr;
+    return (value & ToScanMask) == 0;
+  }
+
+  // Checks UnrollWords words of cards at once; used to skip long runs of
+  // clean or already scanned cards quickly.
+  bool cur_words_of_cards_contain_any_dirty_card() const {
+    assert(cur_addr_aligned(), "Current address should be aligned");
+    size_t const* const words = (size_t*)_cur_addr;
+    size_t value = words[0];
+    for (uint i = 1; i < UnrollWords; i++) {
+      value &= words[i];
+    }
+    return (~value & ExpandedToScanMask) != 0;
+  }
+
+  // Returns the index of the first card in address order whose bit is set
+  // in the given per-card mask of a word of cards.
+  static size_t first_card_in_word(size_t mask) {
+    assert(mask != 0, "must have a card set");
+#ifdef VM_LITTLE_ENDIAN
+    return count_trailing_zeros(mask) / BitsPerByte;
+#else
+    return count_leading_zeros(mask) / BitsPerByte;
+#endif
+  }
+
+  size_t get_and_advance_pos() {
+    _cur_addr++;
+    return pointer_delta(_cur_addr, _base_addr, sizeof(CardValue)) - 1;
+  }
+
+  static const uint UnrollWords = 4;
+
+public:
+  G1CardTableScanner(CardValue* start_card, size_t size) :
+    _base_addr(start_card),
+    _cur_addr(start_card),
+    _end_addr(start_card + size) {
+
+    assert(is_aligned(start_card, sizeof(size_t)), "Unaligned start addr " PTR_FORMAT, p2i(start_card));
+    assert(is_aligned(size, sizeof(size_t)), "Unaligned size " SIZE_FORMAT, size);
+  }
+
+  size_t find_next_dirty() {
+    while (!cur_addr_aligned()) {
+      if (cur_card_is_dirty()) {
+        return get_and_advance_pos();
+      }
+      _cur_addr++;
+    }
+
+    assert(cur_addr_aligned(), "Current address should be aligned now.");
+    while (pointer_delta(_end_addr, _cur_addr, sizeof(CardValue)) >= UnrollWords * sizeof(size_t) &&
+           !cur_words_of_cards_contain_any_dirty_card()) {
+      _cur_addr += UnrollWords * sizeof(size_t);
+    }
+    while (_cur_addr != _end_addr) {
+      size_t const dirty_mask = ~*(size_t*)_cur_addr & ExpandedToScanMask;
+      if (dirty_mask != 0) {
+        _cur_addr += first_card_in_word(dirty_mask);
+        assert(cur_card_is_dirty(), "Should have found a dirty card in the word.");
+        return get_and_advance_pos();
+      }
+      _cur_addr += sizeof(size_t);
+    }
+    return get_and_advance_pos();
+  }
+
+  size_t find_next_non_dirty() {
+    assert(_cur_addr <= _end_addr, "Not allowed to search for marks after area.");
+
+    while (!cur_addr_aligned()) {
+      if (!cur_card_is_dirty()) {
+        return get_and_advance_pos();
+      }
+      _cur_addr++;
+    }
+
+    assert(cur_addr_aligned(), "Current address should be aligned now.");
+    while (_cur_addr != _end_addr) {
+      size_t const non_dirty_mask = *(size_t*)_cur_addr & ExpandedToScanMask;
+      if (non_dirty_mask != 0) {
+        _cur_addr += first_card_in_word(non_dirty_mask);
+        assert(!cur_card_is_dirty(), "Should have found a non-dirty card in the word.");
+        return get_and_advance_pos();
+      }
+      _cur_addr += sizeof(size_t);
+    }
+    return get_and_advance_pos();
+  }
+};
+
+#endif // SHARE_GC_G1_G1CARDTABLESCANNER_HPP
@@ -3616,6 +3616,7 @@ public:
 
   void work(uint worker_id) {
     start_work(worker_id);
+    _task_queues->record_queue_node(worker_id);
 
     {
       ResourceMark rm;
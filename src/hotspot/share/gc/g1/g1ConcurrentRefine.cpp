@@ -327,6 +327,23 @@ static size_t calc_new_green_zone(size_t green,
                                   double goal_ms) {
   // Adjust green zone based on whether we're meeting the time goal.
   // Limit to max_green_zone.
+  if (logged_cards_scan_time > 0.0 && processed_logged_cards > 0) {
+    // Use the measured per-card cost to predict how many cards can be
+    // merged within the goal. Move down to that prediction immediately
+    // if the goal was missed, otherwise grow towards it by half the
+    // distance so that a single quiet pause does not overshoot.
+    double const ms_per_card = logged_cards_scan_time / processed_logged_cards;
+    size_t const target = static_cast<size_t>(MIN2(goal_ms / ms_per_card, (double)max_green_zone));
+    log_debug( CTRL_TAGS )("Predicted green zone: " SIZE_FORMAT " "
+                           "(%.3fus per card, goal: %.3fms)",
+                           target, ms_per_card * 1000.0, goal_ms);
+    if (target < green) {
+      green = logged_cards_scan_time > goal_ms ? target : green - (green - target) / 2;
+    } else if (processed_logged_cards > green) {
+      green = MAX2(green + (target - green) / 2, green + 1);
+    }
+    return MIN2(green, max_green_zone);
+  }
   const double inc_k = 1.1, dec_k = 0.9;
   if (logged_cards_scan_time > goal_ms) {
     if (green > 0) {
@@ -27,6 +27,7 @@
 #include "gc/g1/g1CollectorState.hpp"
 #include "gc/g1/g1ConcurrentMark.inline.hpp"
 #include "gc/g1/g1EvacFailure.hpp"
+#include "gc/g1/g1GCPhaseTimes.hpp"
 #include "gc/g1/g1HeapVerifier.hpp"
 #include "gc/g1/g1OopClosures.inline.hpp"
 #include "gc/g1/g1RedirtyCardsQueue.hpp"
@@ -207,15 +208,24 @@ class RemoveSelfForwardPtrHRClosure: public HeapRegionClosure {
 
   uint volatile* _num_failed_regions;
 
+  // Work done by this worker, for the phase times.
+  size_t _processed_regions;
+  size_t _retained_bytes;
+
 public:
   RemoveSelfForwardPtrHRClosure(G1RedirtyCardsQueueSet* rdcqs, uint worker_id, uint volatile* num_failed_regions) :
     _g1h(G1CollectedHeap::heap()),
     _worker_id(worker_id),
     _rdc_local_qset(rdcqs),
     _log_buffer_cl(&_rdc_local_qset),
-    _num_failed_regions(num_failed_regions) {
+    _num_failed_regions(num_failed_regions),
+    _processed_regions(0),
+    _retained_bytes(0) {
   }
 
+  size_t processed_regions() const { return _processed_regions; }
+  size_t retained_bytes() const { return _retained_bytes; }
+
   ~RemoveSelfForwardPtrHRClosure() {
     _rdc_local_qset.flush();
   }
@@ -256,6 +266,8 @@ public:
 
       hr->note_self_forwarding_removal_end(live_bytes);
 
+      _processed_regions++;
+      _retained_bytes += live_bytes;
       Atomic::inc(_num_failed_regions, memory_order_relaxed);
     }
     return false;
@@ -278,6 +290,12 @@ void G1ParRemoveSelfForwardPtrsTask::work(uint worker_id) {
   // otherwise unreachable object at the very end of the collection. That object
   // might cause an evacuation failure in any region in the collection set.
   _g1h->collection_set_par_iterate_all(&rsfp_cl, &_hrclaimer, worker_id);
+
+  G1GCPhaseTimes* p = _g1h->phase_times();
+  p->record_thread_work_item(G1GCPhaseTimes::RemoveSelfForwardingPtr, worker_id,
+                             rsfp_cl.processed_regions(), G1GCPhaseTimes::RemoveSelfForwardsFailedRegions);
+  p->record_thread_work_item(G1GCPhaseTimes::RemoveSelfForwardingPtr, worker_id,
+                             rsfp_cl.retained_bytes(), G1GCPhaseTimes::RemoveSelfForwardsRetainedBytes);
 }
 
 uint G1ParRemoveSelfForwardPtrsTask::num_failed_regions() const {
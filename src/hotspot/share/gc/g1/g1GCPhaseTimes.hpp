@@ -140,6 +140,11 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
     MergePSSLABUndoWasteBytes
   };
 
+  enum GCRemoveSelfForwardsWorkItems {
+    RemoveSelfForwardsFailedRegions,
+    RemoveSelfForwardsRetainedBytes
+  };
+
   enum GCEagerlyReclaimHumongousObjectsItems {
     EagerlyReclaimNumTotal,
     EagerlyReclaimNumCandidates,
@@ -236,6 +236,18 @@ size_t G1HeapSizingPolicy::full_collection_resize_amount(bool& expand) {
   // with respect to the heap max size as it's an upper bound (i.e.,
   // we'll try to make the capacity smaller than it, not greater).
   maximum_desired_capacity =  MAX2(maximum_desired_capacity, MinHeapSize);
+  // Treat SoftMaxHeapSize as a further upper bound, as long as the heap
+  // keeps at least MinHeapFreeRatio free and does not drop below
+  // MinHeapSize. SoftMaxHeapSize is manageable and may be set below
+  // MinHeapSize at run time, so this lets an operator shrink the heap at
+  // the next remark or full GC without uncommitting below the minimum.
+  const size_t soft_max_capacity = MAX3(SoftMaxHeapSize, minimum_desired_capacity, MinHeapSize);
+  if (maximum_desired_capacity > soft_max_capacity) {
+    log_debug(gc, ergo, heap)("Limit max desired capacity to SoftMaxHeapSize. "
+                              "maximum_desired_capacity: " SIZE_FORMAT "B soft max capacity: " SIZE_FORMAT "B",
+                              maximum_desired_capacity, soft_max_capacity);
+    maximum_desired_capacity = soft_max_capacity;
+  }
 
   // Don't expand unless it's significant; prefer expansion to shrinking.
   if (capacity_after_gc < minimum_desired_capacity) {
@@ -87,6 +87,8 @@ public:
     NewRegionAlloc,
     // Statistics of object processing during copy to survivor region.
     LocalObjProcessAtCopyToSurv,
+    // Statistics of source and destination node of objects promoted to old regions.
+    LocalObjPromotionToOld,
     NodeDataItemsSentinel
   };
 
@@ -34,6 +34,7 @@
 #include "gc/shared/partialArrayTaskStepper.inline.hpp"
 #include "gc/shared/stringdedup/stringDedup.hpp"
 #include "gc/shared/taskqueue.inline.hpp"
+#include "logging/log.hpp"
 #include "memory/allocation.inline.hpp"
 #include "oops/access.inline.hpp"
 #include "oops/oop.inline.hpp"
@@ -79,7 +80,8 @@ G1ParScanThreadState::G1ParScanThreadState(G1CollectedHeap* g1h,
     _string_dedup_requests(),
     _num_optional_regions(optional_cset_length),
     _numa(g1h->numa()),
-    _obj_alloc_stat(NULL)
+    _obj_alloc_stat(NULL),
+    _obj_promote_stat(NULL)
 {
   // We allocate number of young gen regions in the collection set plus one
   // entries, since entry 0 keeps track of surviving bytes for non-young regions.
@@ -109,6 +111,14 @@ G1ParScanThreadState::G1ParScanThreadState(G1CollectedHeap* g1h,
 size_t G1ParScanThreadState::flush(size_t* surviving_young_words) {
   _rdc_local_qset.flush();
   flush_numa_stats();
+  log_trace(gc, plab)("Worker %u PLAB refills: " SIZE_FORMAT " waste: " SIZE_FORMAT "B undo waste: " SIZE_FORMAT "B "
+                      "young PLAB size: " SIZE_FORMAT "B old PLAB size: " SIZE_FORMAT "B",
+                      _worker_id,
+                      _plab_allocator->num_plab_fills(),
+                      lab_waste_words() * HeapWordSize,
+                      lab_undo_waste_words() * HeapWordSize,
+                      _plab_allocator->plab_size(G1HeapRegionAttr::Young) * HeapWordSize,
+                      _plab_allocator->plab_size(G1HeapRegionAttr::Old) * HeapWordSize);
   // Update allocation statistics.
   _plab_allocator->flush_and_retire_stats();
   _g1h->policy()->record_age_table(&_age_table);
@@ -127,6 +137,7 @@ G1ParScanThreadState::~G1ParScanThreadState() {
   FREE_C_HEAP_ARRAY(size_t, _surviving_young_words_base);
   delete[] _oops_into_optional_regions;
   FREE_C_HEAP_ARRAY(size_t, _obj_alloc_stat);
+  FREE_C_HEAP_ARRAY(size_t, _obj_promote_stat);
 }
 
 size_t G1ParScanThreadState::lab_waste_words() const {
@@ -479,6 +490,10 @@ oop G1ParScanThreadState::do_copy_to_survivor_space(G1HeapRegionAttr const regio
       _surviving_young_words[young_index] += word_sz;
     }
 
+    if (_obj_promote_stat != NULL && dest_attr.is_old()) {
+      update_numa_promotion_stats(node_index, obj_ptr);
+    }
+
     if (dest_attr.is_young()) {
       if (age < markWord::max_age) {
         age++;
@@ -636,6 +651,8 @@ void G1ParScanThreadState::initialize_numa_stats() {
       // Record only if there are multiple active nodes.
       _obj_alloc_stat = NEW_C_HEAP_ARRAY(size_t, num_nodes, mtGC);
       memset(_obj_alloc_stat, 0, sizeof(size_t) * num_nodes);
+      _obj_promote_stat = NEW_C_HEAP_ARRAY(size_t, num_nodes * num_nodes, mtGC);
+      memset(_obj_promote_stat, 0, sizeof(size_t) * num_nodes * num_nodes);
     }
   }
 }
@@ -645,6 +662,21 @@ void G1ParScanThreadState::flush_numa_stats() {
     uint node_index = _numa->index_of_current_thread();
     _numa->copy_statistics(G1NUMAStats::LocalObjProcessAtCopyToSurv, node_index, _obj_alloc_stat);
   }
+  if (_obj_promote_stat != NULL) {
+    uint num_nodes = _numa->num_active_nodes();
+    for (uint i = 0; i < num_nodes; i++) {
+      _numa->copy_statistics(G1NUMAStats::LocalObjPromotionToOld, i, &_obj_promote_stat[i * num_nodes]);
+    }
+  }
+}
+
+void G1ParScanThreadState::update_numa_promotion_stats(uint node_index, HeapWord* obj_ptr) {
+  uint num_nodes = _numa->num_active_nodes();
+  uint dest_node_index = _g1h->heap_region_containing(obj_ptr)->node_index();
+  // Regions without a known node do not tell anything about locality.
+  if (node_index < num_nodes && dest_node_index < num_nodes) {
+    _obj_promote_stat[node_index * num_nodes + dest_node_index]++;
+  }
 }
 
 void G1ParScanThreadState::update_numa_stats(uint node_index) {
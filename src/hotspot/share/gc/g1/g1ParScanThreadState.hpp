@@ -105,6 +105,10 @@ class G1ParScanThreadState : public CHeapObj<mtGC> {
   // Only starts recording when log of gc+heap+numa is enabled and its data is
   // transferred when flushed.
   size_t* _obj_alloc_stat;
+  // Records, per node of the source region, on which node promoted objects
+  // ended up. Indexed by source node * number of nodes + destination node.
+  // Recorded and flushed like _obj_alloc_stat.
+  size_t* _obj_promote_stat;
 
 public:
   G1ParScanThreadState(G1CollectedHeap* g1h,
@@ -210,6 +214,7 @@ private:
   void initialize_numa_stats();
   void flush_numa_stats();
   inline void update_numa_stats(uint node_index);
+  void update_numa_promotion_stats(uint node_index, HeapWord* obj_ptr);
 
 public:
   oop copy_to_survivor_space(G1HeapRegionAttr region_attr, oop obj, markWord old_mark);
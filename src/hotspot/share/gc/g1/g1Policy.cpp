@@ -75,6 +75,7 @@ G1Policy::G1Policy(STWGCTimer* gc_timer) :
   _rs_length(0),
   _rs_length_prediction(0),
   _pending_cards_at_gc_start(0),
+  _predicted_pause_time_ms(0.0),
   _concurrent_start_to_mixed(),
   _collection_set(NULL),
   _g1h(NULL),
@@ -811,6 +812,12 @@ void G1Policy::record_collection_pause_end(double pause_time_ms, bool concurrent
     abort_time_to_mixed_tracking();
   }
 
+  log_debug(gc, ergo)("Pause time prediction: predicted: %1.2fms actual: %1.2fms target: %1.2fms",
+                      _predicted_pause_time_ms, pause_time_ms, _mmu_tracker->max_gc_time() * MILLIUNITS);
+  _g1h->gc_tracer_stw()->report_pause_prediction(_predicted_pause_time_ms,
+                                                 pause_time_ms,
+                                                 _mmu_tracker->max_gc_time() * MILLIUNITS);
+
   // Note that _mmu_tracker->max_gc_time() returns the time in seconds.
   double scan_logged_cards_time_goal_ms = _mmu_tracker->max_gc_time() * MILLIUNITS * G1RSetUpdatingPauseTimePercent / 100.0;
 
@@ -1302,7 +1309,6 @@ void G1Policy::calculate_old_collection_set_regions(G1CollectionSetCandidates* c
   uint num_expensive_regions = 0;
 
   double predicted_old_time_ms = 0.0;
-  double predicted_initial_time_ms = 0.0;
   double predicted_optional_time_ms = 0.0;
 
   double optional_threshold_ms = time_remaining_ms * optional_prediction_fraction();
@@ -1369,10 +1375,12 @@ void G1Policy::calculate_old_collection_set_regions(G1CollectionSetCandidates* c
                               num_expensive_regions);
   }
 
+  _predicted_pause_time_ms += predicted_old_time_ms;
+
   log_debug(gc, ergo, cset)("Finish choosing collection set old regions. Initial: %u, optional: %u, "
                             "predicted old time: %1.2fms, predicted optional time: %1.2fms, time remaining: %1.2f",
                             num_initial_regions, num_optional_regions,
-                            predicted_initial_time_ms, predicted_optional_time_ms, time_remaining_ms);
+                            predicted_old_time_ms, predicted_optional_time_ms, time_remaining_ms);
 }
 
 void G1Policy::calculate_optional_collection_set_regions(G1CollectionSetCandidates* candidates,
@@ -109,6 +109,10 @@ class G1Policy: public CHeapObj<mtGC> {
 
   size_t _pending_cards_at_gc_start;
 
+  // Predicted duration of the current pause from choosing the collection set,
+  // excluding optional regions.
+  double _predicted_pause_time_ms;
+
   G1ConcurrentStartToMixedTimeTracker _concurrent_start_to_mixed;
 
   bool should_update_surv_rate_group_predictors() {
@@ -249,6 +253,8 @@ private:
 public:
   size_t pending_cards_at_gc_start() const { return _pending_cards_at_gc_start; }
 
+  void record_predicted_pause_time_ms(double time_ms) { _predicted_pause_time_ms = time_ms; }
+
   // Calculate the minimum number of old regions we'll add to the CSet
   // during a mixed GC.
   uint calc_min_old_cset_length(G1CollectionSetCandidates* candidates) const;
@@ -127,6 +127,12 @@ void G1NewTracer::report_adaptive_ihop_statistics(size_t threshold,
                                 prediction_active);
 }
 
+void G1NewTracer::report_pause_prediction(double predicted_pause_time_ms,
+                                          double pause_time_ms,
+                                          double pause_target_ms) {
+  send_pause_prediction(predicted_pause_time_ms, pause_time_ms, pause_target_ms);
+}
+
 void G1NewTracer::send_g1_young_gc_event() {
   // Check that the pause type has been updated to something valid for this event.
   G1GCPauseTypeHelper::assert_is_young_pause(_pause);
@@ -248,6 +254,19 @@ void G1NewTracer::send_adaptive_ihop_statistics(size_t threshold,
   }
 }
 
+void G1NewTracer::send_pause_prediction(double predicted_pause_time_ms,
+                                        double pause_time_ms,
+                                        double pause_target_ms) {
+  EventG1PausePrediction evt;
+  if (evt.should_commit()) {
+    evt.set_gcId(GCId::current());
+    evt.set_predictedPauseTime((s8)(predicted_pause_time_ms * NANOSECS_PER_MILLISEC));
+    evt.set_pauseTime((s8)(pause_time_ms * NANOSECS_PER_MILLISEC));
+    evt.set_pauseTarget((s8)(pause_target_ms * NANOSECS_PER_MILLISEC));
+    evt.commit();
+  }
+}
+
 void G1OldTracer::report_gc_start_impl(GCCause::Cause cause, const Ticks& timestamp) {
   _shared_gc_info.set_start_timestamp(timestamp);
 }
@@ -63,6 +63,9 @@ public:
                                        double predicted_allocation_rate,
                                        double predicted_marking_length,
                                        bool prediction_active);
+  void report_pause_prediction(double predicted_pause_time_ms,
+                               double pause_time_ms,
+                               double pause_target_ms);
 private:
   void send_g1_young_gc_event();
   void send_evacuation_info_event(G1EvacuationInfo* info);
@@ -84,6 +87,9 @@ private:
                                      double predicted_allocation_rate,
                                      double predicted_marking_length,
                                      bool prediction_active);
+  void send_pause_prediction(double predicted_pause_time_ms,
+                             double pause_time_ms,
+                             double pause_target_ms);
 };
 
 class G1OldTracer : public OldGCTracer {
@@ -32,6 +32,7 @@
 #include "memory/iterator.inline.hpp"
 #include "oops/access.inline.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/prefetch.inline.hpp"
 #include "utilities/align.hpp"
 
@@ -126,46 +127,40 @@ class CheckForPreciseMarks : public BasicOopIterateClosure {
 // when the space is empty, fix the calculation of
 // end_card to allow sp_top == sp->bottom().
 
-// The generation (old gen) is divided into slices, which are further
-// subdivided into stripes, with one stripe per GC thread. The size of
-// a stripe is a constant, ssize.
+// The generation (old gen) is divided into stripes of a constant size,
+// ssize cards each, from bottom to top:
 //
-//      +===============+        slice 0
-//      |  stripe 0     |
-//      +---------------+
-//      |  stripe 1     |
-//      +---------------+
-//      |  stripe 2     |
 //      +---------------+
-//      |  stripe 3     |
-//      +===============+        slice 1
 //      |  stripe 0     |
 //      +---------------+
 //      |  stripe 1     |
 //      +---------------+
 //      |  stripe 2     |
 //      +---------------+
-//      |  stripe 3     |
-//      +===============+        slice 2
 //      ...
 //
-// In this case there are 4 threads, so 4 stripes.  A GC thread first works on
-// its stripe within slice 0 and then moves to its stripe in the next slice
-// until it has exceeded the top of the generation.  The distance to stripe in
-// the next slice is calculated based on the number of stripes.  The next
-// stripe is at ssize * number_of_stripes (= slice_stride)..  So after
-// finishing stripe 0 in slice 0, the thread finds the stripe 0 in slice1 by
-// adding slice_stride to the start of stripe 0 in slice 0 to get to the start
-// of stride 0 in slice 1.
+// The GC threads claim stripes dynamically from the shared claimed_stripes
+// counter, which hands out stripe indices in increasing order, until all
+// stripes up to the top of the generation are claimed. A thread that hits
+// many dirty cards therefore just claims fewer stripes, instead of holding
+// up the others with a fixed share of the generation.
+//
+// An object belongs to the stripe that contains its header. The scan of a
+// stripe is extended past its end to cover the last object of the stripe,
+// and starts after any object that begins in an earlier stripe.
+//
+// Since each thread's stripes are increasing, last_scanned, which is kept
+// across the stripes of one thread, never points beyond the start of a
+// newly claimed stripe. It only suppresses rescanning objects within the
+// current stripe, never objects of a stripe the thread has yet to scan.
 
 void PSCardTable::scavenge_contents_parallel(ObjectStartArray* start_array,
                                              MutableSpace* sp,
                                              HeapWord* space_top,
                                              PSPromotionManager* pm,
-                                             uint stripe_number,
-                                             uint stripe_total) {
-  int ssize = 128; // Naked constant!  Work unit = 64k.
-  int dirty_card_count = 0;
+                                             uint worker_id,
+                                             volatile size_t* claimed_stripes) {
+  const size_t ssize = 128; // Naked constant!  Work unit = 64k.
 
   // It is a waste to get here if empty.
   assert(sp->bottom() < sp->top(), "Should not be called if empty");
@@ -173,15 +168,12 @@ void PSCardTable::scavenge_contents_parallel(ObjectStartArray* start_array,
   CardValue* start_card = byte_for(sp->bottom());
   CardValue* end_card   = byte_for(sp_top - 1) + 1;
   oop* last_scanned = NULL; // Prevent scanning objects more than once
-  // The width of the stripe ssize*stripe_total must be
-  // consistent with the number of stripes so that the complete slice
-  // is covered.
-  size_t slice_width = ssize * stripe_total;
-  for (CardValue* slice = start_card; slice < end_card; slice += slice_width) {
-    CardValue* worker_start_card = slice + stripe_number * ssize;
-    if (worker_start_card >= end_card)
-      return; // We're done.
-
+  const size_t num_stripes = (pointer_delta(end_card, start_card, sizeof(CardValue)) + ssize - 1) / ssize;
+  // Claim stripes in increasing address order, see above.
+  for (size_t stripe = Atomic::fetch_and_add(claimed_stripes, (size_t)1);
+       stripe < num_stripes;
+       stripe = Atomic::fetch_and_add(claimed_stripes, (size_t)1)) {
+    CardValue* worker_start_card = start_card + stripe * ssize;
     CardValue* worker_end_card = worker_start_card + ssize;
     if (worker_end_card > end_card)
       worker_end_card = end_card;
@@ -199,7 +191,7 @@ void PSCardTable::scavenge_contents_parallel(ObjectStartArray* start_array,
     if (GCWorkerDelayMillis > 0) {
       // Delay 1 worker so that it proceeds after all the work
       // has been completed.
-      if (stripe_number < 2) {
+      if (worker_id < 2) {
         os::naked_sleep(GCWorkerDelayMillis);
       }
     }
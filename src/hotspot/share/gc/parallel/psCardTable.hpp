@@ -57,12 +57,15 @@ class PSCardTable: public CardTable {
   static CardValue verify_card_val()     { return verify_card; }
 
   // Scavenge support
+  // Scan the dirty cards of sp below space_top for old-to-young pointers.
+  // Workers claim stripes of cards from the shared claimed_stripes counter,
+  // so workers that hit stripes with few dirty cards take over more stripes.
   void scavenge_contents_parallel(ObjectStartArray* start_array,
                                   MutableSpace* sp,
                                   HeapWord* space_top,
                                   PSPromotionManager* pm,
-                                  uint stripe_number,
-                                  uint stripe_total);
+                                  uint worker_id,
+                                  volatile size_t* claimed_stripes);
 
   bool addr_is_marked_imprecise(void *addr);
   bool addr_is_marked_precise(void *addr);
@@ -1510,6 +1510,42 @@ void PSParallelCompact::fill_dense_prefix_end(SpaceId id)
   }
 }
 
+// Each dense prefix region is summarized into itself, independently of all
+// other regions, so large dense prefixes are split into chunks of regions
+// that are summarized in parallel.
+class PSSummarizeDensePrefixTask : public AbstractGangTask {
+  static const size_t RegionsPerChunk = 1024;
+
+  ParallelCompactData& _summary_data;
+  const size_t         _beg_region;
+  const size_t         _end_region;
+  volatile size_t      _next_region;
+
+public:
+  PSSummarizeDensePrefixTask(ParallelCompactData& summary_data, HeapWord* beg, HeapWord* end) :
+      AbstractGangTask("PSSummarizeDensePrefixTask"),
+      _summary_data(summary_data),
+      _beg_region(summary_data.addr_to_region_idx(beg)),
+      _end_region(summary_data.addr_to_region_idx(end)),
+      _next_region(_beg_region) {}
+
+  static bool should_run_in_parallel(ParallelCompactData& summary_data, HeapWord* beg, HeapWord* end) {
+    return summary_data.addr_to_region_idx(end) - summary_data.addr_to_region_idx(beg) > RegionsPerChunk;
+  }
+
+  void work(uint worker_id) {
+    while (true) {
+      const size_t chunk_beg = Atomic::fetch_and_add(&_next_region, RegionsPerChunk);
+      if (chunk_beg >= _end_region) {
+        return;
+      }
+      const size_t chunk_end = MIN2(chunk_beg + RegionsPerChunk, _end_region);
+      _summary_data.summarize_dense_prefix(_summary_data.region_to_addr(chunk_beg),
+                                           _summary_data.region_to_addr(chunk_end));
+    }
+  }
+};
+
 void
 PSParallelCompact::summarize_space(SpaceId id, bool maximum_compaction)
 {
@@ -1543,7 +1579,12 @@ PSParallelCompact::summarize_space(SpaceId id, bool maximum_compaction)
       fill_dense_prefix_end(id);
 
       // Compute the destination of each Region, and thus each object.
-      _summary_data.summarize_dense_prefix(space->bottom(), dense_prefix_end);
+      if (PSSummarizeDensePrefixTask::should_run_in_parallel(_summary_data, space->bottom(), dense_prefix_end)) {
+        PSSummarizeDensePrefixTask task(_summary_data, space->bottom(), dense_prefix_end);
+        ParallelScavengeHeap::heap()->workers().run_task(&task);
+      } else {
+        _summary_data.summarize_dense_prefix(space->bottom(), dense_prefix_end);
+      }
       _summary_data.summarize(_space_info[id].split_info(),
                               dense_prefix_end, space->top(), NULL,
                               dense_prefix_end, space->end(),
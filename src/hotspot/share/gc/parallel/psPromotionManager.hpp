@@ -124,6 +124,7 @@ class PSPromotionManager {
   static PSPromotionManager* vm_thread_promotion_manager();
 
   static bool steal_depth(int queue_num, ScannerTask& t);
+  static void record_queue_node(uint queue_num);
 
   PSPromotionManager();
 
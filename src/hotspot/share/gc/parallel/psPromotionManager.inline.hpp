@@ -349,6 +349,10 @@ inline bool PSPromotionManager::steal_depth(int queue_num, ScannerTask& t) {
   return stack_array_depth()->steal(queue_num, t);
 }
 
+inline void PSPromotionManager::record_queue_node(uint queue_num) {
+  stack_array_depth()->record_queue_node(queue_num);
+}
+
 #if TASKQUEUE_STATS
 void PSPromotionManager::record_steal(ScannerTask task) {
   if (task.is_partial_array_task()) {
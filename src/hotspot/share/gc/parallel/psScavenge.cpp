@@ -68,6 +68,7 @@
 #include "runtime/vmOperations.hpp"
 #include "services/memoryService.hpp"
 #include "utilities/stack.inline.hpp"
+#include "utilities/ticks.hpp"
 
 HeapWord*                     PSScavenge::_to_space_top_before_gc = NULL;
 int                           PSScavenge::_consecutive_skipped_scavenges = 0;
@@ -285,6 +286,7 @@ class ScavengeRootsTask : public AbstractGangTask {
   uint _active_workers;
   bool _is_empty;
   TaskTerminator _terminator;
+  volatile size_t _claimed_stripes;
 
 public:
   ScavengeRootsTask(PSOldGen* old_gen,
@@ -298,11 +300,13 @@ public:
       _gen_top(gen_top),
       _active_workers(active_workers),
       _is_empty(is_empty),
-      _terminator(active_workers, PSPromotionManager::vm_thread_promotion_manager()->stack_array_depth()) {
+      _terminator(active_workers, PSPromotionManager::vm_thread_promotion_manager()->stack_array_depth()),
+      _claimed_stripes(0) {
   }
 
   virtual void work(uint worker_id) {
     ResourceMark rm;
+    PSPromotionManager::record_queue_node(worker_id);
 
     if (!_is_empty) {
       // There are only old-to-young pointers if there are objects
@@ -317,16 +321,20 @@ public:
       {
         PSPromotionManager* pm = PSPromotionManager::gc_thread_promotion_manager(worker_id);
         PSCardTable* card_table = ParallelScavengeHeap::heap()->card_table();
+        Ticks start = Ticks::now();
 
         card_table->scavenge_contents_parallel(_old_gen->start_array(),
                                                _old_gen->object_space(),
                                                _gen_top,
                                                pm,
                                                worker_id,
-                                               _active_workers);
+                                               &_claimed_stripes);
 
         // Do the real work
         pm->drain_stacks(false);
+
+        log_debug(gc, phases)("Old-to-young card scan (worker %u): %.3fms",
+                              worker_id, (Ticks::now() - start).seconds() * MILLIUNITS);
       }
     }
 
@@ -435,8 +435,25 @@ OopStorage::Block::block_for_ptr(const OopStorage* owner, const oop* ptr) {
 // full.  The block is moved to the end of the _allocation_list if the bitmask
 // is empty, for ease of empty block deletion processing.
 
+// Locks the allocation mutex, counting the acquisitions that had to wait.
+class OopStorage::AllocationLocker : public StackObj {
+  Mutex* _mutex;
+
+public:
+  AllocationLocker(OopStorage* storage) : _mutex(storage->_allocation_mutex) {
+    if (!_mutex->try_lock()) {
+      Atomic::inc(&storage->_allocation_contention_count);
+      _mutex->lock_without_safepoint_check();
+    }
+  }
+
+  ~AllocationLocker() {
+    _mutex->unlock();
+  }
+};
+
 oop* OopStorage::allocate() {
-  MutexLocker ml(_allocation_mutex, Mutex::_no_safepoint_check_flag);
+  AllocationLocker locker(this);
 
   Block* block = block_for_allocation();
   if (block == NULL) return NULL; // Block allocation failed.
@@ -472,7 +489,7 @@ size_t OopStorage::allocate(oop** ptrs, size_t size) {
   Block* block;
   uintx taken;
   {
-    MutexLocker ml(_allocation_mutex, Mutex::_no_safepoint_check_flag);
+    AllocationLocker locker(this);
     block = block_for_allocation();
     if (block == NULL) return 0; // Block allocation failed.
     // Taking all remaining entries, so remove from list.
@@ -835,6 +852,7 @@ OopStorage::OopStorage(const char* name, MEMFLAGS memflags) :
   _active_mutex(make_oopstorage_mutex(name, "active", Mutex::oopstorage - 1)),
   _num_dead_callback(NULL),
   _allocation_count(0),
+  _allocation_contention_count(0),
   _concurrent_iteration_count(0),
   _memflags(memflags),
   _needs_cleanup(false)
@@ -1041,6 +1059,10 @@ size_t OopStorage::allocation_count() const {
   return _allocation_count;
 }
 
+size_t OopStorage::allocation_contention_count() const {
+  return Atomic::load(&_allocation_contention_count);
+}
+
 size_t OopStorage::block_count() const {
   WithActiveArray wab(this);
   // Count access is racy, but don't care.
@@ -1175,6 +1197,7 @@ void OopStorage::print_on(outputStream* st) const {
 
   st->print("%s: " SIZE_FORMAT " entries in " SIZE_FORMAT " blocks (%.F%%), " SIZE_FORMAT " bytes",
             name(), allocations, blocks, alloc_percentage, total_memory_usage());
+  st->print(", " SIZE_FORMAT " contended allocations", allocation_contention_count());
   if (_concurrent_iteration_count > 0) {
     st->print(", concurrent iteration active");
   }
@@ -85,6 +85,10 @@ public:
   // The number of allocated and not yet released entries.
   size_t allocation_count() const;
 
+  // The number of allocations that found the allocation mutex held by
+  // another thread and had to wait for it.
+  size_t allocation_contention_count() const;
+
   // The number of blocks of entries.  Useful for sizing parallel iteration.
   size_t block_count() const;
 
@@ -227,6 +231,7 @@ private:
   class Block;                  // Fixed-size array of oops, plus bookkeeping.
   class ActiveArray;            // Array of Blocks, plus bookkeeping.
   class AllocationListEntry;    // Provides AllocationList links in a Block.
+  class AllocationLocker;       // Counts contended _allocation_mutex acquisitions.
 
   // Doubly-linked list of Blocks.  For all operations with a block
   // argument, the block must be from the list's OopStorage.
@@ -269,6 +274,7 @@ private:
 
   // Volatile for racy unlocked accesses.
   volatile size_t _allocation_count;
+  volatile size_t _allocation_contention_count;
 
   // Protection for _active_array.
   mutable SingleWriterSynchronizer _protect_active;
@@ -62,7 +62,8 @@ BufferNode::Allocator::Allocator(const char* name, size_t buffer_size) :
   _free_list(),
   _pending_count(0),
   _free_count(0),
-  _transfer_lock(false)
+  _transfer_lock(false),
+  _free_list_misses(0)
 {
   strncpy(_name, name, sizeof(_name) - 1);
   _name[sizeof(_name) - 1] = '\0';
@@ -86,6 +87,10 @@ size_t BufferNode::Allocator::free_count() const {
   return Atomic::load(&_free_count);
 }
 
+size_t BufferNode::Allocator::free_list_misses() const {
+  return Atomic::load(&_free_list_misses);
+}
+
 BufferNode* BufferNode::Allocator::allocate() {
   BufferNode* node;
   {
@@ -94,6 +99,7 @@ BufferNode* BufferNode::Allocator::allocate() {
     node = _free_list.pop();
   }
   if (node == NULL) {
+    Atomic::inc(&_free_list_misses);
     node = BufferNode::allocate(_buffer_size);
   } else {
     // Decrement count after getting buffer from free list.  This, along
@@ -186,9 +192,11 @@ size_t BufferNode::Allocator::reduce_free_list(size_t remove_goal) {
     BufferNode::deallocate(node);
   }
   size_t new_count = Atomic::sub(&_free_count, removed);
+  size_t misses = Atomic::xchg(&_free_list_misses, size_t(0));
   log_debug(gc, ptrqueue, freelist)
-           ("Reduced %s free list by " SIZE_FORMAT " to " SIZE_FORMAT,
-            name(), removed, new_count);
+           ("Reduced %s free list by " SIZE_FORMAT " to " SIZE_FORMAT
+            ", " SIZE_FORMAT " allocations missed the free list",
+            name(), removed, new_count, misses);
   return removed;
 }
 
@@ -188,6 +188,9 @@ class BufferNode::Allocator {
   DECLARE_PADDED_MEMBER(3, volatile size_t, _pending_count);
   DECLARE_PADDED_MEMBER(4, volatile size_t, _free_count);
   DECLARE_PADDED_MEMBER(5, volatile bool, _transfer_lock);
+  // Number of allocations that found the free list empty, since the
+  // last reduce_free_list.
+  DECLARE_PADDED_MEMBER(6, volatile size_t, _free_list_misses);
 
 #undef DECLARE_PADDED_MEMBER
 
@@ -203,6 +206,7 @@ public:
   const char* name() const { return _name; }
   size_t buffer_size() const { return _buffer_size; }
   size_t free_count() const;
+  size_t free_list_misses() const;
   BufferNode* allocate();
   void release(BufferNode* node);
 
@@ -246,8 +246,10 @@ void StringDedup::Stat::log_statistics(bool total) const {
   double deduped_bytes_percent       = percent_of(_deduped_bytes, _new_bytes);
   double replaced_percent            = percent_of(_replaced, _new);
   double deleted_percent             = percent_of(_deleted, _new);
+  double process_secs                = _process_elapsed.seconds();
+  double inspected_rate              = (process_secs > 0.0) ? _inspected / process_secs : 0.0;
   log_times(total ? "Total" : "Last");
-  log_debug(stringdedup)("    Inspected:    %12zu", _inspected);
+  log_debug(stringdedup)("    Inspected:    %12zu (%.0f/s)", _inspected, inspected_rate);
   log_debug(stringdedup)("      Known:      %12zu(%5.1f%%)", _known, known_percent);
   log_debug(stringdedup)("      Shared:     %12zu(%5.1f%%)", _known_shared, known_shared_percent);
   log_debug(stringdedup)("      New:        %12zu(%5.1f%%)" STRDEDUP_BYTES_FORMAT,
@@ -34,13 +34,18 @@
 
 #if TASKQUEUE_STATS
 const char * const TaskQueueStats::_names[last_stat_id] = {
-  "qpush", "qpop", "qpop-s", "qattempt", "qsteal", "opush", "omax"
+  "qpush", "qpop", "qpop-s", "qattempt", "qsteal", "qmax", "opush", "omax"
 };
 
 TaskQueueStats & TaskQueueStats::operator +=(const TaskQueueStats & addend)
 {
   for (unsigned int i = 0; i < last_stat_id; ++i) {
-    _stats[i] += addend._stats[i];
+    if (i == queue_max_len || i == overflow_max_len) {
+      // High-water marks do not add up across queues.
+      _stats[i] = MAX2(_stats[i], addend._stats[i]);
+    } else {
+      _stats[i] += addend._stats[i];
+    }
   }
   return *this;
 }
@@ -98,6 +103,9 @@ void TaskQueueStats::verify() const
   assert(get(overflow) == 0 || get(push) != 0,
          "overflow=" SIZE_FORMAT " push=" SIZE_FORMAT,
          get(overflow), get(push));
+  assert(get(queue_max_len) == 0 || get(push) != 0,
+         "queue_max_len=" SIZE_FORMAT " push=" SIZE_FORMAT,
+         get(queue_max_len), get(push));
   assert(get(overflow_max_len) == 0 || get(overflow) != 0,
          "overflow_max_len=" SIZE_FORMAT " overflow=" SIZE_FORMAT,
          get(overflow_max_len), get(overflow));
@@ -57,6 +57,7 @@ public:
     pop_slow,         // subset of taskqueue pops that were done slow-path
     steal_attempt,    // number of taskqueue steal attempts
     steal,            // number of taskqueue steals
+    queue_max_len,    // max occupancy of the taskqueue
     overflow,         // number of overflow pushes
     overflow_max_len, // max length of overflow stack
     last_stat_id
@@ -66,6 +67,7 @@ public:
   inline TaskQueueStats()       { reset(); }
 
   inline void record_push()          { ++_stats[push]; }
+  inline void record_push(size_t new_length);
   inline void record_pop()           { ++_stats[pop]; }
   inline void record_pop_slow()      { record_pop(); ++_stats[pop_slow]; }
   inline void record_steal_attempt() { ++_stats[steal_attempt]; }
@@ -92,6 +94,11 @@ private:
   static const char * const _names[last_stat_id];
 };
 
+void TaskQueueStats::record_push(size_t new_len) {
+  record_push();
+  if (new_len > _stats[queue_max_len]) _stats[queue_max_len] = new_len;
+}
+
 void TaskQueueStats::record_overflow(size_t new_len) {
   ++_stats[overflow];
   if (new_len > _stats[overflow_max_len]) _stats[overflow_max_len] = new_len;
@@ -458,8 +465,17 @@ public:
 private:
   uint _n;
   T** _queues;
+  // NUMA node of the worker owning each queue, as recorded by
+  // record_queue_node(); InvalidNode until then.
+  volatile int* _queue_node;
+  // Set once any owner has recorded its node.
+  volatile bool _has_queue_nodes;
+
+  static const int InvalidNode = -1;
 
   bool steal_best_of_2(uint queue_num, E& t);
+  // Try to steal from a queue owned by a worker on the same NUMA node.
+  bool steal_same_node(uint queue_num, E& t);
 
 public:
   GenericTaskQueueSet(uint n);
@@ -471,6 +487,11 @@ public:
 
   T* queue(uint n);
 
+  // Record the NUMA node of the calling thread as the node of the owner of
+  // queue_num. Owners call this once when they start working on their queue;
+  // steal() only prefers same-node victims after that.
+  void record_queue_node(uint queue_num);
+
   // Try to steal a task from some other queue than queue_num. It may perform several attempts at doing so.
   // Returns if stealing succeeds, and sets "t" to the stolen task.
   bool steal(uint queue_num, E& t);
@@ -30,22 +30,27 @@
 #include "memory/allocation.inline.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/atomic.hpp"
+#include "runtime/globals.hpp"
 #include "runtime/orderAccess.hpp"
+#include "runtime/os.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/stack.inline.hpp"
 
 template <class T, MEMFLAGS F>
-inline GenericTaskQueueSet<T, F>::GenericTaskQueueSet(uint n) : _n(n) {
+inline GenericTaskQueueSet<T, F>::GenericTaskQueueSet(uint n) : _n(n), _has_queue_nodes(false) {
   typedef T* GenericTaskQueuePtr;
   _queues = NEW_C_HEAP_ARRAY(GenericTaskQueuePtr, n, F);
+  _queue_node = NEW_C_HEAP_ARRAY(int, n, F);
   for (uint i = 0; i < n; i++) {
     _queues[i] = NULL;
+    _queue_node[i] = InvalidNode;
   }
 }
 
 template <class T, MEMFLAGS F>
 inline GenericTaskQueueSet<T, F>::~GenericTaskQueueSet() {
   FREE_C_HEAP_ARRAY(T*, _queues);
+  FREE_C_HEAP_ARRAY(int, _queue_node);
 }
 
 template<class E, MEMFLAGS F, unsigned int N>
@@ -78,7 +83,7 @@ GenericTaskQueue<E, F, N>::push(E t) {
   if (dirty_n_elems < max_elems()) {
     _elems[localBot] = t;
     release_set_bottom(increment_index(localBot));
-    TASKQUEUE_STATS_ONLY(stats.record_push());
+    TASKQUEUE_STATS_ONLY(stats.record_push(dirty_n_elems + 1));
     return true;
   }
   return false;                 // Queue is full.
@@ -317,8 +322,54 @@ GenericTaskQueueSet<T, F>::steal_best_of_2(uint queue_num, E& t) {
   }
 }
 
+template<class T, MEMFLAGS F> void
+GenericTaskQueueSet<T, F>::record_queue_node(uint queue_num) {
+  assert(queue_num < _n, "index out of range.");
+  if (!UseNUMA || _n <= 2 || os::numa_get_groups_num() <= 1) {
+    return;
+  }
+  int node = os::numa_get_group_id();
+  if (Atomic::load(&_queue_node[queue_num]) != node) {
+    Atomic::store(&_queue_node[queue_num], node);
+  }
+  if (!Atomic::load(&_has_queue_nodes)) {
+    Atomic::store(&_has_queue_nodes, true);
+  }
+}
+
+template<class T, MEMFLAGS F> bool
+GenericTaskQueueSet<T, F>::steal_same_node(uint queue_num, E& t) {
+  int node = Atomic::load(&_queue_node[queue_num]);
+  if (node == InvalidNode) {
+    return false;
+  }
+
+  // Scan from a random start so that workers on the same node do not all
+  // pick the same victim.
+  T* const local_queue = _queues[queue_num];
+  uint start = local_queue->next_random_queue_id() % _n;
+  for (uint i = 0; i < _n; i++) {
+    uint k = (start + i) % _n;
+    if (k == queue_num || Atomic::load(&_queue_node[k]) != node) {
+      continue;
+    }
+    if (_queues[k]->size() > 0 && _queues[k]->pop_global(t)) {
+      local_queue->set_last_stolen_queue_id(k);
+      return true;
+    }
+  }
+  return false;
+}
+
 template<class T, MEMFLAGS F> bool
 GenericTaskQueueSet<T, F>::steal(uint queue_num, E& t) {
+  if (Atomic::load(&_has_queue_nodes)) {
+    TASKQUEUE_STATS_ONLY(queue(queue_num)->stats.record_steal_attempt());
+    if (steal_same_node(queue_num, t)) {
+      TASKQUEUE_STATS_ONLY(queue(queue_num)->stats.record_steal());
+      return true;
+    }
+  }
   for (uint i = 0; i < 2 * _n; i++) {
     TASKQUEUE_STATS_ONLY(queue(queue_num)->stats.record_steal_attempt());
     if (steal_best_of_2(queue_num, t)) {
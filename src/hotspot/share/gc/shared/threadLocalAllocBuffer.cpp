@@ -85,10 +85,10 @@ void ThreadLocalAllocBuffer::accumulate_and_reset_statistics(ThreadLocalAllocSta
 
   print_stats("gc");
 
-  if (_number_of_refills > 0) {
-    // Update allocation history if a reasonable amount of eden was allocated.
-    bool update_allocation_history = used > 0.5 * capacity;
+  // Update allocation history if a reasonable amount of eden was allocated.
+  bool update_allocation_history = used > 0.5 * capacity;
 
+  if (_number_of_refills > 0) {
     if (update_allocation_history) {
       // Average the fraction of eden allocated in a tlab by this
       // thread for use in the next resize operation.
@@ -109,6 +109,12 @@ void ThreadLocalAllocBuffer::accumulate_and_reset_statistics(ThreadLocalAllocSta
   } else {
     assert(_number_of_refills == 0 && _refill_waste == 0 && _gc_waste == 0,
            "tlab stats == 0");
+    if (update_allocation_history) {
+      // The thread did not refill its TLAB since the last GC. Let its
+      // share decay so that mostly idle threads do not keep reserving
+      // a large TLAB sized by an old burst of allocation.
+      _allocation_fraction.sample(MIN2(1.0f, allocated_since_last_gc / (float) used));
+    }
   }
 
   stats->update_slow_allocations(_slow_allocations);
@@ -39,6 +39,7 @@
 #include "gc/shenandoah/shenandoahVMOperations.hpp"
 #include "gc/shenandoah/shenandoahWorkerPolicy.hpp"
 #include "gc/shenandoah/heuristics/shenandoahHeuristics.hpp"
+#include "jfr/jfrEvents.hpp"
 #include "memory/iterator.hpp"
 #include "memory/metaspaceUtils.hpp"
 #include "memory/metaspaceStats.hpp"
@@ -436,9 +437,18 @@ void ShenandoahControlThread::service_stw_degenerated_cycle(GCCause::Cause cause
   GCIdMark gc_id_mark;
   ShenandoahGCSession session(cause);
 
+  EventShenandoahDegeneratedGC event;
+
   ShenandoahDegenGC gc(point);
   gc.collect(cause);
 
+  if (event.should_commit()) {
+    event.set_gcId(GCId::current());
+    event.set_cause(GCCause::to_string(cause));
+    event.set_degenPoint(ShenandoahGC::degen_point_to_string(point));
+    event.commit();
+  }
+
   ShenandoahHeap* const heap = ShenandoahHeap::heap();
   heap->heuristics()->record_success_degenerated();
   heap->shenandoah_policy()->record_success_degenerated();
@@ -357,11 +357,25 @@ void ShenandoahFreeSet::recycle_trash() {
   // lock is not reentrable, check we don't have it
   shenandoah_assert_not_heaplocked();
 
-  for (size_t i = 0; i < _heap->num_regions(); i++) {
-    ShenandoahHeapRegion* r = _heap->get_region(i);
-    if (r->is_trash()) {
+  // Recycle trash regions in small batches: taking the lock once per batch
+  // avoids lock traffic on large heaps, while the bounded batch size keeps
+  // the lock hold time short for concurrent allocators.
+  const size_t batch_size = 32;
+  const size_t num_regions = _heap->num_regions();
+  size_t i = 0;
+  while (i < num_regions) {
+    // Skip to the next trash region without holding the lock
+    if (!_heap->get_region(i)->is_trash()) {
+      i++;
+      continue;
+    }
+
+    {
       ShenandoahHeapLocker locker(_heap->lock());
-      try_recycle_trashed(r);
+      const size_t batch_end = MIN2(i + batch_size, num_regions);
+      for (; i < batch_end; i++) {
+        try_recycle_trashed(_heap->get_region(i));
+      }
     }
     SpinPause(); // allow allocators to take the lock
   }
@@ -67,6 +67,10 @@ inline uint8_t ZForwarding::type() const {
   return _page->type();
 }
 
+inline uint8_t ZForwarding::numa_id() const {
+  return _page->numa_id();
+}
+
 inline uintptr_t ZForwarding::start() const {
   return _virtual.start();
 }
@@ -42,13 +42,16 @@
 #include "logging/log.hpp"
 #include "runtime/globals.hpp"
 #include "runtime/init.hpp"
+#include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/java.hpp"
+#include "runtime/os.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/globalDefinitions.hpp"
 
 static const ZStatCounter       ZCounterAllocationRate("Memory", "Allocation Rate", ZStatUnitBytesPerSecond);
 static const ZStatCounter       ZCounterPageCacheFlush("Memory", "Page Cache Flush", ZStatUnitBytesPerSecond);
 static const ZStatCriticalPhase ZCriticalPhaseAllocationStall("Allocation Stall");
+static const ZStatCriticalPhase ZCriticalPhaseAllocationPacing("Allocation Pacing");
 
 enum ZPageAllocationStall {
   ZPageAllocationStallSuccess,
@@ -485,6 +488,37 @@ bool ZPageAllocator::alloc_page_stall(ZPageAllocation* allocation) {
   return (result == ZPageAllocationStallSuccess);
 }
 
+void ZPageAllocator::alloc_page_pace(uint8_t type, size_t size) {
+  const size_t capacity = soft_max_capacity();
+  const size_t used_bytes = used();
+  const size_t free = capacity > used_bytes ? capacity - used_bytes : 0;
+  const size_t threshold = capacity / 100 * ZPacingThreshold;
+  if (free >= threshold) {
+    // Enough free memory
+    return;
+  }
+
+  // Delay proportionally to how far below the threshold free memory is,
+  // and to the size of the allocation. Small page allocations form the
+  // bulk of mutator allocations and get the base delay.
+  const double pressure = 1.0 - ((double)free / threshold);
+  const double size_factor = MIN2((double)size / ZPageSizeSmall, 1.0 / pressure);
+  const uint64_t delay_ms = MIN2((uint64_t)(ZPacingMaxDelay * pressure * size_factor), (uint64_t)ZPacingMaxDelay);
+  if (delay_ms == 0) {
+    return;
+  }
+
+  ZStatTimer timer(ZCriticalPhaseAllocationPacing);
+  EventZAllocationPacing event;
+
+  {
+    ThreadBlockInVM tbivm(JavaThread::current());
+    os::naked_short_sleep(delay_ms);
+  }
+
+  event.commit(type, size);
+}
+
 bool ZPageAllocator::alloc_page_or_stall(ZPageAllocation* allocation) {
   {
     ZLocker<ZLock> locker(&_lock);
@@ -625,6 +659,13 @@ void ZPageAllocator::alloc_page_failed(ZPageAllocation* allocation) {
 ZPage* ZPageAllocator::alloc_page(uint8_t type, size_t size, ZAllocationFlags flags) {
   EventZPageAllocation event;
 
+  // Pace mutator allocations when running low on memory, so that the
+  // running GC cycle gets a chance to complete before memory runs out.
+  if (ZPacing && !flags.non_blocking() && !flags.worker_relocation() &&
+      is_init_completed() && Thread::current()->is_Java_thread()) {
+    alloc_page_pace(type, size);
+  }
+
 retry:
   ZPageAllocation allocation(type, size, flags);
 
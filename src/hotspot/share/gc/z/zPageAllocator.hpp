@@ -88,6 +88,7 @@ private:
   bool alloc_page_common_inner(uint8_t type, size_t size, ZList<ZPage>* pages);
   bool alloc_page_common(ZPageAllocation* allocation);
   bool alloc_page_stall(ZPageAllocation* allocation);
+  void alloc_page_pace(uint8_t type, size_t size);
   bool alloc_page_or_stall(ZPageAllocation* allocation);
   ZPage* alloc_page_create(ZPageAllocation* allocation);
   ZPage* alloc_page_finalize(ZPageAllocation* allocation);
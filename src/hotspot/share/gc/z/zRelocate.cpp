@@ -28,6 +28,7 @@
 #include "gc/z/zBarrier.inline.hpp"
 #include "gc/z/zForwarding.inline.hpp"
 #include "gc/z/zHeap.inline.hpp"
+#include "gc/z/zNUMA.inline.hpp"
 #include "gc/z/zPage.inline.hpp"
 #include "gc/z/zRelocate.hpp"
 #include "gc/z/zRelocationSet.inline.hpp"
@@ -39,6 +40,9 @@
 #include "runtime/atomic.hpp"
 #include "utilities/debug.hpp"
 
+static const ZStatCounter ZCounterRelocationLocalNUMA("Memory", "Relocation Local NUMA", ZStatUnitOpsPerSecond);
+static const ZStatCounter ZCounterRelocationRemoteNUMA("Memory", "Relocation Remote NUMA", ZStatUnitOpsPerSecond);
+
 ZRelocate::ZRelocate(ZWorkers* workers) :
     _workers(workers) {}
 
@@ -377,9 +381,114 @@ public:
   }
 };
 
+// Distributes the relocation set over NUMA nodes, so that workers first
+// relocate pages from the node they run on. Since small target pages are
+// allocated node-locally, this keeps relocated objects on their original
+// node. Once the local node runs out of work, workers help other nodes.
+class ZRelocateNUMAIterator : public StackObj {
+private:
+  const bool       _enabled;
+  const uint32_t   _count;
+  ZForwarding**    _forwardings;
+  size_t*          _start;
+  volatile size_t* _next;
+
+  bool next(uint32_t numa_id, ZForwarding** forwarding) {
+    const size_t end = _start[numa_id + 1];
+    if (Atomic::load(&_next[numa_id]) >= end) {
+      return false;
+    }
+
+    const size_t index = Atomic::fetch_and_add(&_next[numa_id], (size_t)1);
+    if (index >= end) {
+      return false;
+    }
+
+    *forwarding = _forwardings[index];
+    return true;
+  }
+
+public:
+  ZRelocateNUMAIterator(ZRelocationSet* relocation_set) :
+      _enabled(ZNUMA::is_enabled() && ZNUMA::count() > 1),
+      _count(ZNUMA::count()),
+      _forwardings(NULL),
+      _start(NULL),
+      _next(NULL) {
+    if (!_enabled) {
+      return;
+    }
+
+    _start = NEW_C_HEAP_ARRAY(size_t, _count + 1, mtGC);
+    _next = NEW_C_HEAP_ARRAY(size_t, _count, mtGC);
+
+    size_t* const nforwardings = NEW_C_HEAP_ARRAY(size_t, _count, mtGC);
+    for (uint32_t i = 0; i < _count; i++) {
+      nforwardings[i] = 0;
+    }
+
+    // Count forwardings per node
+    size_t total = 0;
+    ZRelocationSetIterator count_iter(relocation_set);
+    for (ZForwarding* forwarding; count_iter.next(&forwarding);) {
+      nforwardings[forwarding->numa_id()]++;
+      total++;
+    }
+
+    // Lay out forwardings grouped by node
+    _start[0] = 0;
+    for (uint32_t i = 0; i < _count; i++) {
+      _start[i + 1] = _start[i] + nforwardings[i];
+      _next[i] = _start[i];
+      nforwardings[i] = _start[i];
+    }
+
+    _forwardings = NEW_C_HEAP_ARRAY(ZForwarding*, MAX2(total, (size_t)1), mtGC);
+    ZRelocationSetIterator fill_iter(relocation_set);
+    for (ZForwarding* forwarding; fill_iter.next(&forwarding);) {
+      _forwardings[nforwardings[forwarding->numa_id()]++] = forwarding;
+    }
+
+    FREE_C_HEAP_ARRAY(size_t, nforwardings);
+  }
+
+  ~ZRelocateNUMAIterator() {
+    if (_enabled) {
+      FREE_C_HEAP_ARRAY(ZForwarding*, _forwardings);
+      FREE_C_HEAP_ARRAY(size_t, _start);
+      FREE_C_HEAP_ARRAY(size_t, _next);
+    }
+  }
+
+  bool is_enabled() const {
+    return _enabled;
+  }
+
+  bool next(ZForwarding** forwarding) {
+    const uint32_t numa_id = ZNUMA::id();
+
+    // Try local node
+    if (next(numa_id, forwarding)) {
+      ZStatInc(ZCounterRelocationLocalNUMA);
+      return true;
+    }
+
+    // Try remote nodes
+    for (uint32_t i = 1; i < _count; i++) {
+      if (next((numa_id + i) % _count, forwarding)) {
+        ZStatInc(ZCounterRelocationRemoteNUMA);
+        return true;
+      }
+    }
+
+    return false;
+  }
+};
+
 class ZRelocateTask : public ZTask {
 private:
   ZRelocationSetParallelIterator _iter;
+  ZRelocateNUMAIterator          _numa_iter;
   ZRelocateSmallAllocator        _small_allocator;
   ZRelocateMediumAllocator       _medium_allocator;
 
@@ -387,10 +496,18 @@ private:
     return forwarding->type() == ZPageTypeSmall;
   }
 
+  bool next(ZForwarding** forwarding) {
+    if (_numa_iter.is_enabled()) {
+      return _numa_iter.next(forwarding);
+    }
+    return _iter.next(forwarding);
+  }
+
 public:
   ZRelocateTask(ZRelocationSet* relocation_set) :
       ZTask("ZRelocateTask"),
       _iter(relocation_set),
+      _numa_iter(relocation_set),
       _small_allocator(),
       _medium_allocator() {}
 
@@ -403,7 +520,7 @@ public:
     ZRelocateClosure<ZRelocateSmallAllocator> small(&_small_allocator);
     ZRelocateClosure<ZRelocateMediumAllocator> medium(&_medium_allocator);
 
-    for (ZForwarding* forwarding; _iter.next(&forwarding);) {
+    for (ZForwarding* forwarding; next(&forwarding);) {
       if (is_small(forwarding)) {
         small.do_forwarding(forwarding);
       } else {
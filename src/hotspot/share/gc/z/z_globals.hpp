@@ -48,6 +48,18 @@
   product(bool, ZProactive, true,                                           \
           "Enable proactive GC cycles")                                     \
                                                                             \
+  product(bool, ZPacing, false, EXPERIMENTAL,                               \
+          "Slow down allocating threads when free memory runs low, "        \
+          "to avoid allocation stalls")                                     \
+                                                                            \
+  product(uintx, ZPacingThreshold, 10, EXPERIMENTAL,                        \
+          "Percentage of free memory below which allocations are paced")    \
+          range(1, 100)                                                     \
+                                                                            \
+  product(uintx, ZPacingMaxDelay, 10, EXPERIMENTAL,                         \
+          "Maximum delay in milliseconds for pacing a page allocation")     \
+          range(1, 1000)                                                    \
+                                                                            \
   product(bool, ZUncommit, true,                                            \
           "Uncommit unused memory")                                         \
                                                                             \
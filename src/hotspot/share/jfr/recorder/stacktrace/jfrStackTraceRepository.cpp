@@ -28,7 +28,9 @@
 #include "jfr/recorder/repository/jfrChunkWriter.hpp"
 #include "jfr/recorder/stacktrace/jfrStackTraceRepository.hpp"
 #include "jfr/support/jfrThreadLocal.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "utilities/globalCounter.inline.hpp"
 
 /*
  * There are two separate repository instances.
@@ -97,52 +99,74 @@ bool JfrStackTraceRepository::is_modified() const {
   return _last_entries != _entries;
 }
 
+// Entries are looked up without holding JfrStacktrace_lock in add_trace,
+// so they are only deleted after the table has been emptied and all
+// readers that could still see them have left their critical sections.
+static void delete_entries(JfrStackTrace** entries, u4 size) {
+  GlobalCounter::write_synchronize();
+  for (u4 i = 0; i < size; ++i) {
+    JfrStackTrace* stacktrace = entries[i];
+    while (stacktrace != NULL) {
+      JfrStackTrace* next = const_cast<JfrStackTrace*>(stacktrace->next());
+      delete stacktrace;
+      stacktrace = next;
+    }
+  }
+  FREE_C_HEAP_ARRAY(JfrStackTrace*, entries);
+}
+
+JfrStackTrace** JfrStackTraceRepository::detach_entries() {
+  assert_lock_strong(JfrStacktrace_lock);
+  JfrStackTrace** const entries = NEW_C_HEAP_ARRAY(JfrStackTrace*, TABLE_SIZE, mtTracing);
+  memcpy(entries, _table, sizeof(_table));
+  memset(_table, 0, sizeof(_table));
+  _entries = 0;
+  return entries;
+}
+
 size_t JfrStackTraceRepository::write(JfrChunkWriter& sw, bool clear) {
   if (_entries == 0) {
     return 0;
   }
-  MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
-  assert(_entries > 0, "invariant");
+  JfrStackTrace** detached = NULL;
   int count = 0;
-  for (u4 i = 0; i < TABLE_SIZE; ++i) {
-    JfrStackTrace* stacktrace = _table[i];
-    while (stacktrace != NULL) {
-      JfrStackTrace* next = const_cast<JfrStackTrace*>(stacktrace->next());
-      if (stacktrace->should_write()) {
-        stacktrace->write(sw);
-        ++count;
-      }
-      if (clear) {
-        delete stacktrace;
+  {
+    MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
+    assert(_entries > 0, "invariant");
+    for (u4 i = 0; i < TABLE_SIZE; ++i) {
+      const JfrStackTrace* stacktrace = _table[i];
+      while (stacktrace != NULL) {
+        if (stacktrace->should_write()) {
+          stacktrace->write(sw);
+          ++count;
+        }
+        stacktrace = stacktrace->next();
       }
-      stacktrace = next;
     }
+    if (clear) {
+      detached = detach_entries();
+    }
+    _last_entries = _entries;
   }
-  if (clear) {
-    memset(_table, 0, sizeof(_table));
-    _entries = 0;
+  if (detached != NULL) {
+    delete_entries(detached, TABLE_SIZE);
   }
-  _last_entries = _entries;
   return count;
 }
 
 size_t JfrStackTraceRepository::clear(JfrStackTraceRepository& repo) {
-  MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
-  if (repo._entries == 0) {
-    return 0;
-  }
-  for (u4 i = 0; i < TABLE_SIZE; ++i) {
-    JfrStackTrace* stacktrace = repo._table[i];
-    while (stacktrace != NULL) {
-      JfrStackTrace* next = const_cast<JfrStackTrace*>(stacktrace->next());
-      delete stacktrace;
-      stacktrace = next;
+  JfrStackTrace** detached;
+  size_t processed;
+  {
+    MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
+    if (repo._entries == 0) {
+      return 0;
     }
+    processed = repo._entries;
+    detached = repo.detach_entries();
+    repo._last_entries = 0;
   }
-  memset(repo._table, 0, sizeof(repo._table));
-  const size_t processed = repo._entries;
-  repo._entries = 0;
-  repo._last_entries = 0;
+  delete_entries(detached, TABLE_SIZE);
   return processed;
 }
 
@@ -198,8 +222,22 @@ void JfrStackTraceRepository::record_for_leak_profiler(JavaThread* thread, int s
 }
 
 traceid JfrStackTraceRepository::add_trace(const JfrStackTrace& stacktrace) {
-  MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
   const size_t index = stacktrace._hash % TABLE_SIZE;
+  {
+    // Most recorded traces are already in the table, so try to find the
+    // trace without taking the lock first. Entries are immutable once
+    // published and are only deleted after a GlobalCounter synchronization.
+    GlobalCounter::CriticalSection cs(Thread::current());
+    const JfrStackTrace* table_entry = Atomic::load_acquire(&_table[index]);
+    while (table_entry != NULL) {
+      if (table_entry->equals(stacktrace)) {
+        return table_entry->id();
+      }
+      table_entry = table_entry->next();
+    }
+  }
+
+  MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
   const JfrStackTrace* table_entry = _table[index];
 
   while (table_entry != NULL) {
@@ -214,7 +252,7 @@ traceid JfrStackTraceRepository::add_trace(const JfrStackTrace& stacktrace) {
   }
 
   traceid id = ++_next_id;
-  _table[index] = new JfrStackTrace(id, stacktrace, _table[index]);
+  Atomic::release_store(&_table[index], new JfrStackTrace(id, stacktrace, _table[index]));
   ++_entries;
   return id;
 }
@@ -51,8 +51,13 @@ void AsyncLogWriter::enqueue_locked(const AsyncLogMessage& msg) {
   }
 
   assert(_buffer.size() < _buffer_max_size, "_buffer is over-sized.");
+  bool was_empty = _buffer.size() == 0;
   _buffer.push_back(msg);
-  _sem.signal();
+  if (was_empty) {
+    // The writer drains everything that is buffered when it wakes up. A
+    // non-empty buffer means a wakeup is already pending.
+    _sem.signal();
+  }
 }
 
 void AsyncLogWriter::enqueue(LogFileOutput& output, const LogDecorations& decorations, const char* msg) {
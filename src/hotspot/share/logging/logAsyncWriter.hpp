@@ -138,8 +138,9 @@ class AsyncLogWriter : public NonJavaThread {
   static AsyncLogWriter* _instance;
   // _lock(1) denotes a critional region.
   Semaphore _lock;
-  // _sem is a semaphore whose value denotes how many messages have been enqueued.
-  // It decreases in AsyncLogWriter::run()
+  // _sem is signaled when a message is enqueued into an empty buffer.
+  // AsyncLogWriter::run() waits on it and then drains the whole buffer,
+  // so later messages are picked up without further signals.
   Semaphore _sem;
   // A lock of IO
   Semaphore _io_sem;
@@ -41,6 +41,7 @@ class ChunkPool: public CHeapObj<mtInternal> {
   Chunk*       _first;        // first cached Chunk; its first word points to next chunk
   size_t       _num_chunks;   // number of unused chunks in pool
   size_t       _num_used;     // number of chunks currently checked out
+  size_t       _peak_used;    // max of _num_used since the last prune
   const size_t _size;         // size of each chunk (must be uniform)
 
   // Our four static pools
@@ -61,7 +62,7 @@ class ChunkPool: public CHeapObj<mtInternal> {
 
  public:
   // All chunks in a ChunkPool has the same size
-   ChunkPool(size_t size) : _size(size) { _first = NULL; _num_chunks = _num_used = 0; }
+   ChunkPool(size_t size) : _size(size) { _first = NULL; _num_chunks = _num_used = _peak_used = 0; }
 
   // Allocate a new chunk from the pool (might expand the pool)
   NOINLINE void* allocate(size_t bytes, AllocFailType alloc_failmode) {
@@ -71,6 +72,7 @@ class ChunkPool: public CHeapObj<mtInternal> {
     // should be done outside ThreadCritical lock due to NMT
     { ThreadCritical tc;
       _num_used++;
+      _peak_used = MAX2(_peak_used, _num_used);
       p = get_first();
     }
     if (p == NULL) p = os::malloc(bytes, mtChunk, CURRENT_PC);
@@ -92,13 +94,20 @@ class ChunkPool: public CHeapObj<mtInternal> {
     _num_chunks++;
   }
 
-  // Prune the pool
+  // Prune the pool. Keep at least n chunks, and enough chunks to cover the
+  // peak demand seen since the last prune, so that a steady allocation
+  // rate (e.g. from compiler arenas) does not churn malloc. An idle pool
+  // shrinks to n chunks after one more cleaning interval.
   void free_all_but(size_t n) {
     Chunk* cur = NULL;
     Chunk* next;
     {
-      // if we have more than n chunks, free all of them
       ThreadCritical tc;
+      if (_peak_used > _num_used) {
+        n = MAX2(n, _peak_used - _num_used);
+      }
+      _peak_used = _num_used;
+      // if we have more than n chunks, free all of them
       if (_num_chunks > n) {
         // free chunks at end of queue, for better locality
         cur = _first;
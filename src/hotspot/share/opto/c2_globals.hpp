@@ -189,6 +189,11 @@
   product(bool, PostLoopMultiversioning, false, EXPERIMENTAL,               \
            "Multi versioned post loops to eliminate range checks")          \
                                                                             \
+  product(bool, UseMaskedPostLoop, false,                                   \
+          "Multi version post loops of vectorized loops and run the post "  \
+          "loop as one vector iteration with masked loads and stores. "     \
+          "Post loops that cannot be masked stay scalar")                   \
+                                                                            \
   notproduct(bool, TraceSuperWordLoopUnrollAnalysis, false,                 \
           "Trace what Superword Level Parallelism analysis applies")        \
                                                                             \
@@ -394,6 +399,12 @@
   product(bool, UseOnlyInlinedBimorphic, true,                              \
           "Don't use BimorphicInlining if can't inline a second method")    \
                                                                             \
+  product(intx, PolymorphicInliningLimit, 2,                                \
+          "Maximum number of profiled receiver types handled with type "    \
+          "checks at a virtual call site, most frequent first. Values "     \
+          "above 2 need TypeProfileWidth at least as large")                \
+          range(2, 8)                                                       \
+                                                                            \
   develop(bool, SubsumeLoads, true,                                         \
           "Attempt to compile while subsuming loads into machine "          \
           "instructions.")                                                  \
@@ -411,6 +422,17 @@
           "Set level of loop optimization for tier 1 compiles")             \
           range(5, 43)                                                      \
                                                                             \
+  product(uintx, C2CompileTimeBudget, 0,                                    \
+          "Compile time in milliseconds after which C2 skips further loop " \
+          "optimization rounds, split-if and superword (0 = no limit)")     \
+          range(0, max_jint)                                                \
+                                                                            \
+  product(uintx, C2CompileNodeBudget, 0,                                    \
+          "Number of live nodes after which C2 skips further loop "         \
+          "optimization rounds, split-if and superword. MaxNodeLimit and "  \
+          "other bailouts still apply (0 = no limit)")                      \
+          range(0, max_jint)                                                \
+                                                                            \
   /* controls for heat-based inlining */                                    \
                                                                             \
   develop(intx, NodeCountInliningCutoff, 18000,                             \
@@ -487,6 +509,10 @@
   product(bool, EliminateAllocations, true,                                 \
           "Use escape analysis to eliminate allocations")                   \
                                                                             \
+  product(bool, ReduceAllocationMerges, false, DIAGNOSTIC,                  \
+          "Split field loads through Phis merging new objects of the same " \
+          "klass so the merged allocations can be scalar replaced")         \
+                                                                            \
   notproduct(bool, PrintEliminateAllocations, false,                        \
           "Print out when allocations are eliminated")                      \
                                                                             \
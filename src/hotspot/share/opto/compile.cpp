@@ -72,6 +72,7 @@
 #include "opto/vector.hpp"
 #include "opto/vectornode.hpp"
 #include "runtime/globals_extension.hpp"
+#include "runtime/os.hpp"
 #include "runtime/sharedRuntime.hpp"
 #include "runtime/signature.hpp"
 #include "runtime/stubRoutines.hpp"
@@ -972,6 +973,8 @@ void Compile::Init(int aliaslevel) {
 
   set_do_freq_based_layout(_directive->BlockLayoutByFrequencyOption);
   _loop_opts_cnt = LoopOptsCount;
+  _start_nanos = os::javaTimeNanos();
+  _over_budget = false;
   set_do_inlining(Inline);
   set_max_inline_size(MaxInlineSize);
   set_freq_inline_size(FreqInlineSize);
@@ -2008,10 +2011,35 @@ void Compile::process_late_inline_calls_no_inline(PhaseIterGVN& igvn) {
   }
 }
 
+// Once the compile time or node budget is exhausted, further loop opts
+// rounds, split-if and superword are skipped. This produces a valid but
+// less optimized nmethod instead of spending more CPU or bailing out and
+// leaving the method at tier 3.
+bool Compile::over_budget() {
+  if (_over_budget) {
+    return true;
+  }
+  const char* reason = NULL;
+  if (C2CompileTimeBudget > 0 &&
+      (os::javaTimeNanos() - _start_nanos) >= (jlong)C2CompileTimeBudget * NANOSECS_PER_MILLISEC) {
+    reason = "time";
+  } else if (C2CompileNodeBudget > 0 && live_nodes() >= C2CompileNodeBudget) {
+    reason = "nodes";
+  }
+  if (reason != NULL) {
+    _over_budget = true;
+    _loop_opts_cnt = 0; // No more loop opts rounds
+    if (log() != NULL) {
+      log()->elem("over_budget reason='%s' live_nodes='%d'", reason, live_nodes());
+    }
+  }
+  return _over_budget;
+}
+
 bool Compile::optimize_loops(PhaseIterGVN& igvn, LoopOptsMode mode) {
   if (_loop_opts_cnt > 0) {
     debug_only( int cnt = 0; );
-    while (major_progress() && (_loop_opts_cnt > 0)) {
+    while (major_progress() && !over_budget() && (_loop_opts_cnt > 0)) {
       TracePhase tp("idealLoop", &timers[_t_idealLoop]);
       assert( cnt++ < 40, "infinite cycle in loop optimization" );
       PhaseIdealLoop::optimize(igvn, mode);
@@ -2184,7 +2212,7 @@ void Compile::Optimize() {
   // peeling, unrolling, etc.
 
   // Set loop opts counter
-  if((_loop_opts_cnt > 0) && (has_loops() || has_split_ifs())) {
+  if(!over_budget() && (_loop_opts_cnt > 0) && (has_loops() || has_split_ifs())) {
     {
       TracePhase tp("idealLoop", &timers[_t_idealLoop]);
       PhaseIdealLoop::optimize(igvn, LoopOptsDefault);
@@ -2193,7 +2221,7 @@ void Compile::Optimize() {
       if (failing())  return;
     }
     // Loop opts pass if partial peeling occurred in previous pass
-    if(PartialPeelLoop && major_progress() && (_loop_opts_cnt > 0)) {
+    if(PartialPeelLoop && major_progress() && !over_budget() && (_loop_opts_cnt > 0)) {
       TracePhase tp("idealLoop", &timers[_t_idealLoop]);
       PhaseIdealLoop::optimize(igvn, LoopOptsSkipSplitIf);
       _loop_opts_cnt--;
@@ -2201,7 +2229,7 @@ void Compile::Optimize() {
       if (failing())  return;
     }
     // Loop opts pass for loop-unrolling before CCP
-    if(major_progress() && (_loop_opts_cnt > 0)) {
+    if(major_progress() && !over_budget() && (_loop_opts_cnt > 0)) {
       TracePhase tp("idealLoop", &timers[_t_idealLoop]);
       PhaseIdealLoop::optimize(igvn, LoopOptsSkipSplitIf);
       _loop_opts_cnt--;
@@ -4734,7 +4762,8 @@ void Compile::sort_macro_nodes() {
 void Compile::print_method(CompilerPhaseType cpt, const char *name, int level) {
   EventCompilerPhase event;
   if (event.should_commit()) {
-    CompilerEvent::PhaseEvent::post(event, C->_latest_stage_start_counter, cpt, C->_compile_id, level);
+    CompilerEvent::PhaseEvent::post(event, C->_latest_stage_start_counter, cpt, C->_compile_id, level,
+                                    live_nodes(), comp_arena()->size_in_bytes() + node_arena()->size_in_bytes());
   }
 #ifndef PRODUCT
   if (should_print(level)) {
@@ -4771,7 +4800,8 @@ void Compile::print_method(CompilerPhaseType cpt, Node* n, int level) {
 void Compile::end_method(int level) {
   EventCompilerPhase event;
   if (event.should_commit()) {
-    CompilerEvent::PhaseEvent::post(event, C->_latest_stage_start_counter, PHASE_END, C->_compile_id, level);
+    CompilerEvent::PhaseEvent::post(event, C->_latest_stage_start_counter, PHASE_END, C->_compile_id, level,
+                                    live_nodes(), comp_arena()->size_in_bytes() + node_arena()->size_in_bytes());
   }
 
 #ifndef PRODUCT
@@ -224,9 +224,14 @@ CallGenerator* Compile::call_generator(ciMethod* callee, int vtable_index, bool
           speculative_receiver_type = NULL;
         }
       }
+      // Number of receivers that get their own type check: all of them when
+      // the site is known to see at most PolymorphicInliningLimit types.
+      int checked_receivers = 1;
+      if (morphism >= 2 && UseBimorphicInlining && morphism <= PolymorphicInliningLimit) {
+        checked_receivers = morphism;
+      }
       if (receiver_method == NULL &&
-          (have_major_receiver || morphism == 1 ||
-           (morphism == 2 && UseBimorphicInlining))) {
+          (have_major_receiver || morphism == 1 || checked_receivers > 1)) {
         // receiver_method = profile.method();
         // Profiles do not suggest methods now.  Look it up in the major receiver.
         receiver_method = callee->resolve_invoke(jvms->method()->holder(),
@@ -237,28 +242,33 @@ CallGenerator* Compile::call_generator(ciMethod* callee, int vtable_index, bool
         CallGenerator* hit_cg = this->call_generator(receiver_method,
               vtable_index, !call_does_dispatch, jvms, allow_inline, prof_factor);
         if (hit_cg != NULL) {
-          // Look up second receiver.
-          CallGenerator* next_hit_cg = NULL;
-          ciMethod* next_receiver_method = NULL;
-          if (morphism == 2 && UseBimorphicInlining) {
-            next_receiver_method = callee->resolve_invoke(jvms->method()->holder(),
-                                                               profile.receiver(1));
-            if (next_receiver_method != NULL) {
-              next_hit_cg = this->call_generator(next_receiver_method,
-                                  vtable_index, !call_does_dispatch, jvms,
-                                  allow_inline, prof_factor);
-              if (next_hit_cg != NULL && !next_hit_cg->is_inline() &&
-                  have_major_receiver && UseOnlyInlinedBimorphic) {
-                  // Skip if we can't inline second receiver's method
-                  next_hit_cg = NULL;
-              }
+          // Look up the remaining receivers, in order of decreasing frequency.
+          // Stop at the first one that can't be handled; the rest then goes
+          // through the virtual call.
+          CallGenerator* next_hit_cg[ciCallProfile::MorphismLimit];
+          ciMethod* next_receiver_method[ciCallProfile::MorphismLimit];
+          int next_hits = 1;
+          for (; next_hits < checked_receivers; next_hits++) {
+            ciMethod* m = callee->resolve_invoke(jvms->method()->holder(),
+                                                 profile.receiver(next_hits));
+            if (m == NULL) {
+              break;
+            }
+            CallGenerator* cg = this->call_generator(m, vtable_index, !call_does_dispatch, jvms,
+                                                     allow_inline, prof_factor);
+            if (cg == NULL || (!cg->is_inline() && have_major_receiver && UseOnlyInlinedBimorphic)) {
+              // Skip if we can't inline this receiver's method
+              break;
             }
+            next_receiver_method[next_hits] = m;
+            next_hit_cg[next_hits] = cg;
           }
+          bool all_receivers_checked = (checked_receivers > 1 && next_hits == checked_receivers);
           CallGenerator* miss_cg;
-          Deoptimization::DeoptReason reason = (morphism == 2
+          Deoptimization::DeoptReason reason = (morphism >= 2
                                                ? Deoptimization::Reason_bimorphic
                                                : Deoptimization::reason_class_check(speculative_receiver_type != NULL));
-          if ((morphism == 1 || (morphism == 2 && next_hit_cg != NULL)) &&
+          if ((morphism == 1 || all_receivers_checked) &&
               !too_many_traps_or_recompiles(caller, bci, reason)
              ) {
             // Generate uncommon trap for class check failure path
@@ -272,12 +282,24 @@ CallGenerator* Compile::call_generator(ciMethod* callee, int vtable_index, bool
                                                 : CallGenerator::for_virtual_call(callee, vtable_index));
           }
           if (miss_cg != NULL) {
-            if (next_hit_cg != NULL) {
+            // Build the cascade of type checks from the least frequent receiver up.
+            // remaining_count is the number of calls that reach the check of receiver i.
+            int remaining_count = 0;
+            if (!all_receivers_checked) {
+              remaining_count = site_count;
+              for (int i = 0; i < next_hits; i++) {
+                remaining_count -= profile.receiver_count(i);
+              }
+              remaining_count = MAX2(remaining_count, 0);
+            }
+            for (int i = next_hits - 1; i >= 1 && miss_cg != NULL; i--) {
               assert(speculative_receiver_type == NULL, "shouldn't end up here if we used speculation");
-              trace_type_profile(C, jvms->method(), jvms->depth() - 1, jvms->bci(), next_receiver_method, profile.receiver(1), site_count, profile.receiver_count(1));
+              remaining_count += profile.receiver_count(i);
+              trace_type_profile(C, jvms->method(), jvms->depth() - 1, jvms->bci(), next_receiver_method[i], profile.receiver(i), site_count, profile.receiver_count(i));
+              float prob = MIN2((float)PROB_MAX, (float)profile.receiver_count(i) / remaining_count);
               // We don't need to record dependency on a receiver here and below.
               // Whenever we inline, the dependency is added by Parse::Parse().
-              miss_cg = CallGenerator::for_predicted_call(profile.receiver(1), miss_cg, next_hit_cg, PROB_MAX);
+              miss_cg = CallGenerator::for_predicted_call(profile.receiver(i), miss_cg, next_hit_cg[i], prob);
             }
             if (miss_cg != NULL) {
               ciKlass* k = speculative_receiver_type != NULL ? speculative_receiver_type : profile.receiver(0);
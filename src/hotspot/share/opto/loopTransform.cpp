@@ -3409,11 +3409,11 @@ bool IdealLoopTree::iteration_split_impl(PhaseIdealLoop *phase, Node_List &old_n
       if (phase->do_range_check(this, old_new) != 0) {
         cl->mark_has_range_checks();
       }
-    } else if (PostLoopMultiversioning) {
+    } else if (PhaseIdealLoop::post_loop_multiversioning_enabled()) {
       phase->has_range_checks(this);
     }
 
-    if (should_unroll && !should_peel && PostLoopMultiversioning) {
+    if (should_unroll && !should_peel && PhaseIdealLoop::post_loop_multiversioning_enabled()) {
       // Try to setup multiversioning on main loops before they are unrolled
       if (cl->is_main_loop() && (cl->unrolled_count() == 1)) {
         phase->insert_scalar_rced_post_loop(this, old_new);
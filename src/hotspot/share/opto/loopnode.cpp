@@ -3978,7 +3978,7 @@ void PhaseIdealLoop::build_and_optimize(LoopOptsMode mode) {
 
   // Check for aggressive application of split-if and other transforms
   // that require basic-block info (like cloning through Phi's)
-  if (!C->major_progress() && SplitIfBlocks && do_split_ifs) {
+  if (!C->major_progress() && SplitIfBlocks && do_split_ifs && !C->over_budget()) {
     visited.clear();
     split_if_with_blocks( visited, nstack);
     NOT_PRODUCT( if( VerifyLoopOptimizations ) verify(); );
@@ -4051,7 +4051,7 @@ void PhaseIdealLoop::build_and_optimize(LoopOptsMode mode) {
   }
 
   // Convert scalar to superword operations at the end of all loop opts.
-  if (UseSuperWord && C->has_loops() && !C->major_progress()) {
+  if (UseSuperWord && C->has_loops() && !C->major_progress() && !C->over_budget()) {
     // SuperWord transform
     SuperWord sw(this);
     for (LoopTreeIterator iter(_ltree_root); !iter.done(); iter.next()) {
@@ -4059,7 +4059,7 @@ void PhaseIdealLoop::build_and_optimize(LoopOptsMode mode) {
       if (lpt->is_counted()) {
         CountedLoopNode *cl = lpt->_head->as_CountedLoop();
 
-        if (PostLoopMultiversioning && cl->is_rce_post_loop() && !cl->is_vectorized_loop()) {
+        if (post_loop_multiversioning_enabled() && cl->is_rce_post_loop() && !cl->is_vectorized_loop()) {
           // Check that the rce'd post loop is encountered first, multiversion after all
           // major main loop optimization are concluded
           if (!C->major_progress()) {
@@ -1248,6 +1248,11 @@ public:
                          CountedLoopNode *main_head, CountedLoopEndNode *main_end,
                          Node *incr, Node *limit, CountedLoopNode *&post_head);
 
+  // Are post loops multi-versioned, so that SuperWord can vectorize them?
+  static bool post_loop_multiversioning_enabled() {
+    return PostLoopMultiversioning || UseMaskedPostLoop;
+  }
+
   // Add an RCE'd post loop which we will multi-version adapt for run time test path usage
   void insert_scalar_rced_post_loop( IdealLoopTree *loop, Node_List &old_new );
 
@@ -1498,6 +1498,43 @@ static bool stable_phi(PhiNode* phi, PhaseGVN *phase) {
   }
   return true;
 }
+//------------------------------is_merge_of_allocations------------------------
+// Is base a Phi which merges only new instances of the same exact klass?
+// Field loads from such a Phi can be split through it, which leaves the
+// merged allocations without field uses so they can be scalar replaced.
+static bool is_merge_of_allocations(Node* base, PhaseGVN* phase) {
+  if (!ReduceAllocationMerges || base == NULL || !base->is_Phi() || base->in(0) == NULL) {
+    return false;
+  }
+  ciKlass* klass = NULL;
+  for (uint i = 1; i < base->req(); i++) {
+    Node* in = base->in(i);
+    if (in == NULL || in == phase->C->top()) {
+      continue; // dead path
+    }
+    const TypeInstPtr* t = phase->type(in)->isa_instptr();
+    if (t == NULL || !t->klass_is_exact() ||
+        AllocateNode::Ideal_allocation(in, phase) == NULL) {
+      return false;
+    }
+    if (klass == NULL) {
+      klass = t->klass();
+    } else if (t->klass() != klass) {
+      return false;
+    }
+  }
+  return klass != NULL;
+}
+
+bool LoadNode::is_field_of_merged_allocations(PhaseGVN* phase) const {
+  Node* address = in(Address);
+  intptr_t ignore = 0;
+  Node* base = AddPNode::Ideal_base_and_offset(address, phase, ignore);
+  return base != NULL && base == address->in(AddPNode::Base) &&
+         base == address->in(AddPNode::Address) &&
+         is_merge_of_allocations(base, phase);
+}
+
 //------------------------------split_through_phi------------------------------
 // Split instance or boxed field load through Phi.
 Node *LoadNode::split_through_phi(PhaseGVN *phase) {
@@ -1507,7 +1544,8 @@ Node *LoadNode::split_through_phi(PhaseGVN *phase) {
 
   assert((t_oop != NULL) &&
          (t_oop->is_known_instance_field() ||
-          t_oop->is_ptr_to_boxed_value()), "invalide conditions");
+          t_oop->is_ptr_to_boxed_value() ||
+          is_field_of_merged_allocations(phase)), "invalide conditions");
 
   Compile* C = phase->C;
   intptr_t ignore = 0;
@@ -1516,9 +1554,12 @@ Node *LoadNode::split_through_phi(PhaseGVN *phase) {
   bool load_boxed_values = t_oop->is_ptr_to_boxed_value() && C->aggressive_unboxing() &&
                            (base != NULL) && (base == address->in(AddPNode::Base)) &&
                            phase->type(base)->higher_equal(TypePtr::NOTNULL);
+  // Fields of merged allocations are split through the base Phi like boxed values.
+  bool load_merged_fields = !t_oop->is_known_instance() && base_is_phi &&
+                            is_field_of_merged_allocations(phase);
 
   if (!((mem->is_Phi() || base_is_phi) &&
-        (load_boxed_values || t_oop->is_known_instance_field()))) {
+        (load_boxed_values || load_merged_fields || t_oop->is_known_instance_field()))) {
     return NULL; // memory is not Phi
   }
 
@@ -1603,8 +1644,8 @@ Node *LoadNode::split_through_phi(PhaseGVN *phase) {
   int this_index  = C->get_alias_index(t_oop);
   int this_offset = t_oop->offset();
   int this_iid    = t_oop->instance_id();
-  if (!t_oop->is_known_instance() && load_boxed_values) {
-    // Use _idx of address base for boxed values.
+  if (!t_oop->is_known_instance() && (load_boxed_values || load_merged_fields)) {
+    // Use _idx of address base for boxed values and merged allocations.
     this_iid = base->_idx;
   }
   PhaseIterGVN* igvn = phase->is_IterGVN();
@@ -1761,7 +1802,8 @@ Node *LoadNode::Ideal(PhaseGVN *phase, bool can_reshape) {
     const TypeOopPtr *t_oop = addr_t->isa_oopptr();
     if ((t_oop != NULL) &&
         (t_oop->is_known_instance_field() ||
-         t_oop->is_ptr_to_boxed_value())) {
+         t_oop->is_ptr_to_boxed_value() ||
+         is_field_of_merged_allocations(phase))) {
       PhaseIterGVN *igvn = phase->is_IterGVN();
       assert(igvn != NULL, "must be PhaseIterGVN when can_reshape is true");
       if (igvn->_worklist.member(opt_mem)) {
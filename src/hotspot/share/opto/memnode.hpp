@@ -246,6 +246,8 @@ public:
 
   // Split instance field load through Phi.
   Node* split_through_phi(PhaseGVN *phase);
+  // Is this a field load from a Phi merging new objects of the same klass?
+  bool is_field_of_merged_allocations(PhaseGVN* phase) const;
 
   // Recover original value from boxed values
   Node *eliminate_autobox(PhaseIterGVN *igvn);
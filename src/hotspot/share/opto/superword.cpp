@@ -108,7 +108,7 @@ void SuperWord::transform_loop(IdealLoopTree* lpt, bool do_optimization) {
 
   if (!cl->is_valid_counted_loop(T_INT)) return; // skip malformed counted loop
 
-  bool post_loop_allowed = (PostLoopMultiversioning && Matcher::has_predicated_vectors() && cl->is_post_loop());
+  bool post_loop_allowed = (post_loop_vectorization_enabled() && cl->is_post_loop());
   if (post_loop_allowed) {
     if (cl->is_reduction_loop()) return; // no predication mapping
     Node *limit = cl->limit();
@@ -178,7 +178,7 @@ void SuperWord::transform_loop(IdealLoopTree* lpt, bool do_optimization) {
   if (do_optimization) {
     assert(_packset.length() == 0, "packset must be empty");
     SLP_extract();
-    if (PostLoopMultiversioning && Matcher::has_predicated_vectors()) {
+    if (post_loop_vectorization_enabled()) {
       if (cl->is_vectorized_loop() && cl->is_main_loop() && !cl->is_reduction_loop()) {
         IdealLoopTree *lpt_next = lpt->_next;
         CountedLoopNode *cl_next = lpt_next->_head->as_CountedLoop();
@@ -213,7 +213,7 @@ void SuperWord::unrolling_analysis(int &local_loop_unroll_factor) {
   }
 
   int max_vector = Matcher::max_vector_size(T_BYTE);
-  bool post_loop_allowed = (PostLoopMultiversioning && Matcher::has_predicated_vectors() && cl->is_post_loop());
+  bool post_loop_allowed = (post_loop_vectorization_enabled() && cl->is_post_loop());
 
   // Process the loop, some/all of the stack entries will not be in order, ergo
   // need to preprocess the ignored initial state before we process the loop
@@ -476,7 +476,7 @@ void SuperWord::SLP_extract() {
   compute_max_depth();
 
   CountedLoopNode *cl = lpt()->_head->as_CountedLoop();
-  bool post_loop_allowed = (PostLoopMultiversioning && Matcher::has_predicated_vectors() && cl->is_post_loop());
+  bool post_loop_allowed = (post_loop_vectorization_enabled() && cl->is_post_loop());
   if (cl->is_main_loop()) {
     if (_do_vector_loop_experimental) {
       if (mark_generations() != -1) {
@@ -1344,6 +1344,29 @@ bool SuperWord::reduction(Node* s1, Node* s2) {
   return retValue;
 }
 
+//------------------------------is_widening_reduction---------------------------
+// Is n a reduction whose operand in(2) has a narrower integer element type
+// than the reduction itself, e.g. an AddI reduction over LoadB/LoadS values?
+bool SuperWord::is_widening_reduction(Node* n) {
+  if (!n->is_reduction() || !in_bb(n->in(2))) {
+    return false;
+  }
+  BasicType in_bt = velt_basic_type(n->in(2));
+  return velt_basic_type(n) == T_INT && (in_bt == T_BYTE || in_bt == T_SHORT);
+}
+
+//------------------------------feeds_widening_reduction------------------------
+// Is def the narrow operand of a widening reduction in the block?
+bool SuperWord::feeds_widening_reduction(Node* def) {
+  for (DUIterator_Fast imax, i = def->fast_outs(imax); i < imax; i++) {
+    Node* use = def->fast_out(i);
+    if (in_bb(use) && use->in(2) == def && is_widening_reduction(use)) {
+      return true;
+    }
+  }
+  return false;
+}
+
 //------------------------------independent_path------------------------------
 // Helper for independent
 bool SuperWord::independent_path(Node* shallow, Node* deep, uint dp) {
@@ -1475,6 +1498,7 @@ bool SuperWord::follow_def_uses(Node_List* p) {
   int num_s1_uses = 0;
   Node* u1 = NULL;
   Node* u2 = NULL;
+  int u_align = align;
   for (DUIterator_Fast imax, i = s1->fast_outs(imax); i < imax; i++) {
     Node* t1 = s1->fast_out(i);
     num_s1_uses++;
@@ -1485,12 +1509,19 @@ bool SuperWord::follow_def_uses(Node_List* p) {
       if (t2->Opcode() == Op_AddI && t2 == _lp->as_CountedLoop()->incr()) continue; // don't mess with the iv
       if (!opnd_positions_match(s1, t1, s2, t2))
         continue;
-      if (stmts_can_pack(t1, t2, align)) {
+      int t_align = align;
+      if (align >= 0 && is_widening_reduction(t1) && t1->in(2) == s1) {
+        // Elements of a widening reduction are wider than their operands:
+        // scale the alignment to the size of the reduction elements.
+        t_align = align * (data_size(t1) / data_size(s1));
+      }
+      if (stmts_can_pack(t1, t2, t_align)) {
         int my_savings = est_savings(t1, t2);
         if (my_savings > savings) {
           savings = my_savings;
           u1 = t1;
           u2 = t2;
+          u_align = t_align;
         }
       }
     }
@@ -1503,8 +1534,8 @@ bool SuperWord::follow_def_uses(Node_List* p) {
     pair->push(u1);
     pair->push(u2);
     _packset.append(pair);
-    NOT_PRODUCT(if(is_trace_alignment()) tty->print_cr("SuperWord::follow_def_uses: set_alignment(%d, %d, %d)", u1->_idx, u2->_idx, align);)
-    set_alignment(u1, u2, align);
+    NOT_PRODUCT(if(is_trace_alignment()) tty->print_cr("SuperWord::follow_def_uses: set_alignment(%d, %d, %d)", u1->_idx, u2->_idx, u_align);)
+    set_alignment(u1, u2, u_align);
     changed = true;
   }
   return changed;
@@ -1685,6 +1716,11 @@ void SuperWord::combine_packs() {
     if (p1 != NULL) {
       BasicType bt = velt_basic_type(p1->at(0));
       uint max_vlen = Matcher::max_vector_size(bt); // Max elements in vector
+      if (feeds_widening_reduction(p1->at(0))) {
+        // Keep the narrow operand pack in step with the reduction pack
+        // consuming it: the operand vector is widened before reduction.
+        max_vlen = MIN2(max_vlen, (uint)Matcher::max_vector_size(T_INT));
+      }
       assert(is_power_of_2(max_vlen), "sanity");
       uint psize = p1->size();
       if (!is_power_of_2(psize)) {
@@ -2006,6 +2042,11 @@ bool SuperWord::implemented(Node_List* p) {
         retValue = false;
       } else {
         retValue = ReductionNode::implemented(opc, size, arith_type->basic_type());
+        if (retValue && is_widening_reduction(p0)) {
+          // The narrow operand vector has to be widened before reduction.
+          BasicType in_bt = velt_basic_type(p0->in(2));
+          retValue = Matcher::match_rule_supported_vector(VectorCastNode::opcode(in_bt), size, arith_type->basic_type());
+        }
       }
     } else {
       retValue = VectorNode::implemented(opc, size, velt_basic_type(p0));
@@ -2419,7 +2460,24 @@ void SuperWord::output() {
 
   uint max_vlen_in_bytes = 0;
   uint max_vlen = 0;
-  bool can_process_post_loop = (PostLoopMultiversioning && Matcher::has_predicated_vectors() && cl->is_post_loop());
+  bool can_process_post_loop = (post_loop_vectorization_enabled() && cl->is_post_loop());
+  // Prefer masked vector memory operations for the single iteration post loop:
+  // the mask is an ordinary VectorMaskGen and no vector mask register needs to
+  // be reserved and programmed for the whole loop.
+  bool use_masked_mem_ops = can_process_post_loop && masked_post_loop_implemented();
+  if (can_process_post_loop && !use_masked_mem_ops &&
+      !(PostLoopMultiversioning && Matcher::has_predicated_vectors())) {
+    // Only UseMaskedPostLoop is on, and there is no SetVectMaskI fallback:
+    // keep the scalar post loop.
+    NOT_PRODUCT(if(TraceSuperWord) {tty->print_cr("SuperWord::output: masked post loop not implemented, exiting SuperWord");})
+    return;
+  }
+  // Masks of the remaining post loop iterations, one per element type,
+  // shared by all memory packs with that type.
+  Node* post_loop_masks[T_CONFLICT + 1];
+  for (int i = 0; i <= T_CONFLICT; i++) {
+    post_loop_masks[i] = NULL;
+  }
 
   NOT_PRODUCT(if(is_trace_loop_reverse()) {tty->print_cr("SWPointer::output: print loop before create_reserve_version_of_loop"); print_loop(true);})
 
@@ -2466,7 +2524,13 @@ void SuperWord::output() {
         }
         Node* adr = low_adr->in(MemNode::Address);
         const TypePtr* atyp = n->adr_type();
-        vn = LoadVectorNode::make(opc, ctl, mem, adr, atyp, vlen, velt_basic_type(n), control_dependency(p));
+        if (use_masked_mem_ops) {
+          BasicType bt = velt_basic_type(n);
+          Node* mask = post_loop_mask(bt, post_loop_masks);
+          vn = new LoadVectorMaskedNode(ctl, mem, adr, atyp, TypeVect::make(bt, vlen), mask);
+        } else {
+          vn = LoadVectorNode::make(opc, ctl, mem, adr, atyp, vlen, velt_basic_type(n), control_dependency(p));
+        }
         vlen_in_bytes = vn->as_LoadVector()->memory_size();
       } else if (n->is_Store()) {
         // Promote value to be stored to vector
@@ -2483,7 +2547,12 @@ void SuperWord::output() {
         Node* mem = first->in(MemNode::Memory);
         Node* adr = low_adr->in(MemNode::Address);
         const TypePtr* atyp = n->adr_type();
-        vn = StoreVectorNode::make(opc, ctl, mem, adr, atyp, val, vlen);
+        if (use_masked_mem_ops) {
+          Node* mask = post_loop_mask(velt_basic_type(n), post_loop_masks);
+          vn = new StoreVectorMaskedNode(ctl, mem, adr, val, atyp, mask);
+        } else {
+          vn = StoreVectorNode::make(opc, ctl, mem, adr, atyp, val, vlen);
+        }
         vlen_in_bytes = vn->as_StoreVector()->memory_size();
       } else if (VectorNode::is_scalar_rotate(n)) {
         Node* in1 = low_adr->in(1);
@@ -2540,6 +2609,14 @@ void SuperWord::output() {
         }
         if (node_isa_reduction) {
           const Type *arith_type = n->bottom_type();
+          BasicType in2_bt = in2->bottom_type()->is_vect()->element_basic_type();
+          if (arith_type->basic_type() == T_INT && (in2_bt == T_BYTE || in2_bt == T_SHORT)) {
+            // Widening reduction: widen the narrow operand vector to the
+            // reduction element type first.
+            in2 = VectorCastNode::make(VectorCastNode::opcode(in2_bt), in2, arith_type->basic_type(), vlen);
+            _igvn.register_new_node_with_optimizer(in2);
+            _phase->set_ctrl(in2, _phase->get_ctrl(p->at(0)));
+          }
           vn = ReductionNode::make(opc, NULL, in1, in2, arith_type->basic_type());
           if (in2->is_Load()) {
             vlen_in_bytes = in2->as_LoadVector()->memory_size();
@@ -2701,7 +2778,16 @@ void SuperWord::output() {
         }
 
         if (do_reserve_copy()) {
-          if (can_process_post_loop) {
+          if (use_masked_mem_ops) {
+            // The memory operations are masked to the remaining trip count,
+            // so a single iteration with the full vector stride drains the loop.
+            Node *incr = cl->incr();
+            AddINode *new_incr = new AddINode(incr->in(1), _igvn.intcon(max_vlen));
+            _igvn.register_new_node_with_optimizer(new_incr);
+            _phase->set_ctrl(new_incr, _phase->get_ctrl(incr));
+            _igvn.replace_node(incr, new_incr);
+            cl->mark_is_multiversioned();
+          } else if (can_process_post_loop) {
             // Now create the difference of trip and limit and use it as our mask index.
             // Note: We limited the unroll of the vectorized loop so that
             //       only vlen-1 size iterations can remain to be mask programmed.
@@ -2730,6 +2816,74 @@ void SuperWord::output() {
   return;
 }
 
+//------------------------------post_loop_vectorization_enabled---------------------------
+// Does SuperWord vectorize multi-versioned post loops? With PostLoopMultiversioning
+// this needs a vector mask register, UseMaskedPostLoop only uses masked
+// memory operations, see masked_post_loop_implemented().
+bool SuperWord::post_loop_vectorization_enabled() {
+  return (PostLoopMultiversioning && Matcher::has_predicated_vectors()) || UseMaskedPostLoop;
+}
+
+//------------------------------masked_post_loop_implemented---------------------------
+// Can all packs of the post loop be emitted with the main loop's vector length,
+// with masked vector memory operations?
+bool SuperWord::masked_post_loop_implemented() {
+  CountedLoopNode *cl = lpt()->_head->as_CountedLoop();
+  if (cl->stride_con() != 1) {
+    return false;
+  }
+  // All packs are emitted with this many lanes, see output().
+  uint vlen = cl->slp_max_unroll();
+  for (int i = 0; i < _packset.length(); i++) {
+    Node* p0 = _packset.at(i)->at(0);
+    BasicType bt = velt_basic_type(p0);
+    // The lanes of every pack must fit in a vector of its element type.
+    if (vlen < 2 || (int)vlen > Matcher::max_vector_size(bt)) {
+      return false;
+    }
+    if (p0->is_Mem()) {
+      int vopc = p0->is_Load() ? Op_LoadVectorMasked : Op_StoreVectorMasked;
+      if (!Matcher::match_rule_supported_vector(vopc, vlen, bt) ||
+          !Matcher::match_rule_supported_vector(Op_VectorMaskGen, vlen, bt)) {
+        return false;
+      }
+    } else if (!VectorNode::implemented(p0->Opcode(), vlen, bt)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+//------------------------------post_loop_mask---------------------------
+// Return the mask of the remaining post loop iterations for elements of type
+// bt. Masks are created once per element type and cached in masks.
+Node* SuperWord::post_loop_mask(BasicType bt, Node** masks) {
+  if (masks[bt] != NULL) {
+    return masks[bt];
+  }
+  CountedLoopNode *cl = lpt()->_head->as_CountedLoop();
+  Node* entry = cl->in(LoopNode::EntryControl);
+  Node* len = NULL;
+  for (int i = 0; i <= T_CONFLICT && len == NULL; i++) {
+    if (masks[i] != NULL) {
+      len = masks[i]->in(1); // reuse the trip count of another element type
+    }
+  }
+  if (len == NULL) {
+    Node* index = new SubINode(cl->limit(), cl->init_trip());
+    _igvn.register_new_node_with_optimizer(index);
+    _phase->set_ctrl(index, entry);
+    len = new ConvI2LNode(index);
+    _igvn.register_new_node_with_optimizer(len);
+    _phase->set_ctrl(len, entry);
+  }
+  Node* mask = new VectorMaskGenNode(len, TypeVect::VECTMASK, bt);
+  _igvn.register_new_node_with_optimizer(mask);
+  _phase->set_ctrl(mask, entry);
+  masks[bt] = mask;
+  return mask;
+}
+
 //------------------------------vector_opd---------------------------
 // Create a vector operand for the nodes in pack p for operand: in(opd_idx)
 Node* SuperWord::vector_opd(Node_List* p, int opd_idx) {
@@ -2738,7 +2892,7 @@ Node* SuperWord::vector_opd(Node_List* p, int opd_idx) {
   Node* opd = p0->in(opd_idx);
   CountedLoopNode *cl = lpt()->_head->as_CountedLoop();
 
-  if (PostLoopMultiversioning && Matcher::has_predicated_vectors() && cl->is_post_loop()) {
+  if (post_loop_vectorization_enabled() && cl->is_post_loop()) {
     // override vlen with the main loops vector length
     vlen = cl->slp_max_unroll();
   }
@@ -471,6 +471,10 @@ class SuperWord : public ResourceObj {
   bool have_similar_inputs(Node* s1, Node* s2);
   // Is there a data path between s1 and s2 and both are reductions?
   bool reduction(Node* s1, Node* s2);
+  // Is n a reduction over operands of a narrower integer type?
+  bool is_widening_reduction(Node* n);
+  // Is def the narrow operand of a widening reduction?
+  bool feeds_widening_reduction(Node* def);
   // Helper for independent
   bool independent_path(Node* shallow, Node* deep, uint dp=0);
   void set_alignment(Node* s1, Node* s2, int align);
@@ -510,6 +514,12 @@ class SuperWord : public ResourceObj {
 
   // Convert packs into vector node operations
   void output();
+  // Does SuperWord vectorize multi-versioned post loops?
+  static bool post_loop_vectorization_enabled();
+  // Can the post loop use masked vector memory operations?
+  bool masked_post_loop_implemented();
+  // Get the mask of the remaining post loop iterations, cached per element type
+  Node* post_loop_mask(BasicType bt, Node** masks);
   // Create a vector operand for the nodes in pack p for operand: in(opd_idx)
   Node* vector_opd(Node_List* p, int opd_idx);
   // Can code be generated for pack p?
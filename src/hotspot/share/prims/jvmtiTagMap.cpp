@@ -1056,6 +1056,13 @@ void IterateThroughHeapObjectClosure::do_object(oop obj) {
     return;
   }
 
+  // Most objects are untagged. If those are filtered out, skip them before
+  // looking up the class tag and setting up the callback wrapper.
+  if ((heap_filter() & JVMTI_HEAP_FILTER_UNTAGGED) != 0 &&
+      tag_map()->hashmap()->find(obj) == NULL) {
+    return;
+  }
+
   // prepare for callback
   CallbackWrapper wrapper(tag_map(), obj);
 
@@ -869,14 +869,18 @@ class DeoptimizeMarkedClosure : public HandshakeClosure {
 void Deoptimization::deoptimize_all_marked(nmethod* nmethod_only) {
   ResourceMark rm;
   DeoptimizationMarker dm;
+  EventDeoptimizeMarked event;
+  int made_not_entrant = 0;
 
   // Make the dependent methods not entrant
   if (nmethod_only != NULL) {
     nmethod_only->mark_for_deoptimization();
-    nmethod_only->make_not_entrant();
+    if (nmethod_only->make_not_entrant()) {
+      made_not_entrant = 1;
+    }
   } else {
     MutexLocker mu(SafepointSynchronize::is_at_safepoint() ? NULL : CodeCache_lock, Mutex::_no_safepoint_check_flag);
-    CodeCache::make_marked_nmethods_not_entrant();
+    made_not_entrant = CodeCache::make_marked_nmethods_not_entrant();
   }
 
   DeoptimizeMarkedClosure deopt;
@@ -885,6 +889,11 @@ void Deoptimization::deoptimize_all_marked(nmethod* nmethod_only) {
   } else {
     Handshake::execute(&deopt);
   }
+
+  if (event.should_commit()) {
+    event.set_methodCount(made_not_entrant);
+    event.commit();
+  }
 }
 
 Deoptimization::DeoptAction Deoptimization::_unloaded_action
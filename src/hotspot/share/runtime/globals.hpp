@@ -721,6 +721,13 @@ const intx ObjectAlignmentInBytes = 8;
   product(intx, hashCode, 5, EXPERIMENTAL,                                  \
                "(Unstable) select hashCode generation algorithm")           \
                                                                             \
+  product(int, ParkSpinLimit, 0, EXPERIMENTAL,                               \
+          "Maximum number of SpinPause iterations a thread spins for a "    \
+          "permit in LockSupport.park before blocking. The spin length "    \
+          "adapts to how often spinning succeeds. 0 disables spinning. "    \
+          "(Ignored for Windows)")                                          \
+          range(0, 100000)                                                  \
+                                                                            \
   product(bool, FilterSpuriousWakeups, true,                                \
           "When true prevents OS-level spurious, or premature, wakeups "    \
           "from Object.wait (Ignored for Windows)")                         \
@@ -918,6 +925,12 @@ const intx ObjectAlignmentInBytes = 8;
              "Reduce the number of parallel compiler threads when they "    \
              "are not used")                                                \
                                                                             \
+  product(uintx, DynamicCompilerThreadsCPUPercent, 100,                     \
+          "Maximum number of dynamically started compiler threads, as a "   \
+          "percentage of the processors currently available to the VM "     \
+          "(follows the container CPU quota)")                              \
+          range(1, 100)                                                     \
+                                                                            \
   product(bool, TraceCompilerThreads, false, DIAGNOSTIC,                    \
              "Trace creation and removal of compiler threads")              \
                                                                             \
@@ -1157,6 +1170,11 @@ const intx ObjectAlignmentInBytes = 8;
   product(bool, UseInterpreter, true,                                       \
           "Use interpreter for non-compiled methods")                       \
                                                                             \
+  product(int, OopMapCacheSize, 32,                                         \
+          "Number of entries in the interpreter oop map cache of each "     \
+          "class")                                                          \
+          range(8, 4096)                                                    \
+                                                                            \
   develop(bool, UseFastSignatureHandlers, true,                             \
           "Use fast signature handlers for native calls")                   \
                                                                             \
@@ -24,6 +24,7 @@
 
 #include "precompiled.hpp"
 #include "jvm_io.h"
+#include "jfr/jfrEvents.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "memory/resourceArea.hpp"
@@ -216,6 +217,14 @@ static void check_handshake_timeout(jlong start_time, HandshakeOperation* op, Ja
 }
 
 static void log_handshake_info(jlong start_time_ns, const char* name, int targets, int emitted_handshakes_executed, const char* extra = NULL) {
+  EventHandshake event;
+  if (event.should_commit()) {
+    event.set_operation(name);
+    event.set_targetedThreads(targets);
+    event.set_executedByRequester(emitted_handshakes_executed);
+    event.set_completionTime(os::javaTimeNanos() - start_time_ns);
+    event.commit();
+  }
   if (log_is_enabled(Info, handshake)) {
     jlong completion_time = os::javaTimeNanos() - start_time_ns;
     log_info(handshake)("Handshake \"%s\", Targeted threads: %d, Executed by requesting thread: %d, Total completion time: " JLONG_FORMAT " ns%s%s",
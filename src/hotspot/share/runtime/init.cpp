@@ -45,6 +45,7 @@
 #include "runtime/handles.inline.hpp"
 #include "runtime/icache.hpp"
 #include "runtime/init.hpp"
+#include "runtime/os.hpp"
 #include "runtime/safepoint.hpp"
 #include "runtime/sharedRuntime.hpp"
 #include "services/memTracker.hpp"
@@ -83,6 +84,7 @@ void vmStructs_init() NOT_DEBUG_RETURN;
 void vtableStubs_init();
 void InlineCacheBuffer_init();
 void compilerOracle_init();
+void hotMethodList_init();
 bool compileBroker_init();
 void dependencyContext_init();
 void dependencies_init();
@@ -110,19 +112,38 @@ void vm_init_globals() {
 }
 
 
+// Logs the time spent in each step of init_globals at startuptime debug
+// level, breaking down the coarse "Create VM" timer.
+class InitStepTimer : public StackObj {
+  jlong _last;
+ public:
+  InitStepTimer() : _last(os::elapsed_counter()) {}
+  void done(const char* step) {
+    jlong now = os::elapsed_counter();
+    log_debug(startuptime)("Init step %s: %.3f ms", step,
+                           (double)(now - _last) * MILLIUNITS / os::elapsed_frequency());
+    _last = now;
+  }
+};
+
 jint init_globals() {
+  InitStepTimer timer;
   management_init();
   JvmtiExport::initialize_oop_storage();
   bytecodes_init();
   classLoader_init1();
   compilationPolicy_init();
+  timer.done("early runtime");
   codeCache_init();
   VM_Version_init();              // depends on codeCache_init for emitting code
+  timer.done("code cache and CPU features");
   stubRoutines_init1();
+  timer.done("stubs 1");
   jint status = universe_init();  // dependent on codeCache_init and
                                   // stubRoutines_init1 and metaspace_init.
   if (status != JNI_OK)
     return status;
+  timer.done("universe");
 
   AsyncLogWriter::initialize();
   gc_barrier_stubs_init();  // depends on universe_init, must be before interpreter_init
@@ -131,9 +152,12 @@ jint init_globals() {
   InterfaceSupport_init();
   VMRegImpl::set_regName(); // need this before generate_stubs (for printing oop maps).
   SharedRuntime::generate_stubs();
+  timer.done("interpreter and runtime stubs");
   universe2_init();  // dependent on codeCache_init and stubRoutines_init1
+  timer.done("universe genesis");
   javaClasses_init();// must happen after vtable initialization, before referenceProcessor_init
   interpreter_init_code();  // after javaClasses_init and before any method gets linked
+  timer.done("interpreter code");
   referenceProcessor_init();
   jni_handles_init();
 #if INCLUDE_VM_STRUCTS
@@ -143,6 +167,7 @@ jint init_globals() {
   vtableStubs_init();
   InlineCacheBuffer_init();
   compilerOracle_init();
+  hotMethodList_init();
   dependencyContext_init();
   dependencies_init();
 
@@ -154,12 +179,16 @@ jint init_globals() {
     JVMCI::initialize_globals();
   }
 #endif
+  timer.done("JNI handles, vtable stubs and compiler");
 
   if (!universe_post_init()) {
     return JNI_ERR;
   }
+  timer.done("universe post init");
   stubRoutines_init2(); // note: StubRoutines need 2-phase init
+  timer.done("stubs 2");
   MethodHandles::generate_adapters();
+  timer.done("method handle adapters");
 
   // All the flags that get adjusted by VM_Version_init and os::init_2
   // have been set so dump the flags now.
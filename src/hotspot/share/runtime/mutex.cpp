@@ -108,7 +108,9 @@ void Mutex::lock(Thread* self) {
 
   if (!_lock.try_lock()) {
     // The lock is contended, use contended slow-path function to lock
+    jlong start = os::javaTimeNanos();
     lock_contended(self);
+    record_contended(start);
   }
 
   assert_owner(NULL);
@@ -119,6 +121,11 @@ void Mutex::lock() {
   lock(Thread::current());
 }
 
+void Mutex::record_contended(jlong start_nanos) {
+  _contended_count++;
+  _contended_nanos += os::javaTimeNanos() - start_nanos;
+}
+
 // Lock without safepoint check - a degenerate variant of lock() for use by
 // JavaThreads when it is known to be safe to not check for a safepoint when
 // acquiring this lock. If the thread blocks acquiring the lock it is not
@@ -131,7 +138,11 @@ void Mutex::lock_without_safepoint_check(Thread * self) {
   check_no_safepoint_state(self);
   check_rank(self);
 
-  _lock.lock();
+  if (!_lock.try_lock()) {
+    jlong start = os::javaTimeNanos();
+    _lock.lock();
+    record_contended(start);
+  }
   assert_owner(NULL);
   set_owner(self);
 }
@@ -262,7 +273,8 @@ Mutex::~Mutex() {
 }
 
 Mutex::Mutex(int Rank, const char * name, bool allow_vm_block,
-             SafepointCheckRequired safepoint_check_required) : _owner(NULL) {
+             SafepointCheckRequired safepoint_check_required) :
+  _owner(NULL), _contended_count(0), _contended_nanos(0) {
   assert(os::mutex_init_done(), "Too early!");
   assert(name != NULL, "Mutex requires a name");
   _name = os::strdup(name, mtInternal);
@@ -87,6 +87,12 @@ class Mutex : public CHeapObj<mtSynchronizer> {
   os::PlatformMonitor _lock;             // Native monitor implementation
   const char* _name;                     // Name of mutex/monitor
 
+  // Contention statistics, updated by the thread that acquired the lock
+  // after it had to block, so they are protected by the lock itself.
+  uint64_t _contended_count;             // Number of acquisitions that blocked
+  jlong    _contended_nanos;             // Total time spent blocked
+  void record_contended(jlong start_nanos);
+
   // Debugging fields for naming, deadlock detection, etc. (some only used in debug mode)
 #ifndef PRODUCT
   bool    _allow_vm_block;
@@ -194,6 +200,10 @@ class Mutex : public CHeapObj<mtSynchronizer> {
 
   const char *name() const                  { return _name; }
 
+  // Contention statistics; racy when read by a thread not owning the lock.
+  uint64_t contended_count() const          { return _contended_count; }
+  jlong contended_nanos() const             { return _contended_nanos; }
+
   void print_on_error(outputStream* st) const;
   #ifndef PRODUCT
     void print_on(outputStream* st) const;
@@ -384,3 +384,17 @@ void print_owned_locks_on_error(outputStream* st) {
   }
   if (none) st->print_cr("None");
 }
+
+// Print contention statistics for the named global mutexes/monitors that
+// have blocked at least once, in creation order.
+void print_lock_stats(outputStream* st) {
+  st->print_cr("%-32s %12s %14s", "Lock", "Contended", "Blocked (ms)");
+  for (int i = 0; i < _num_mutex; i++) {
+    Mutex* m = _mutex_array[i];
+    uint64_t count = m->contended_count();
+    if (count > 0) {
+      st->print_cr("%-32s " UINT64_FORMAT_W(12) " %14.3f", m->name(), count,
+                   (double)m->contended_nanos() / NANOSECS_PER_MILLISEC);
+    }
+  }
+}
@@ -180,6 +180,9 @@ extern Mutex* tty_lock;                          // lock to synchronize output.
 // by fatal error handler.
 void print_owned_locks_on_error(outputStream* st);
 
+// Print contention statistics of the global mutexes/monitors.
+void print_lock_stats(outputStream* st);
+
 char *lock_name(Mutex *mutex);
 
 // for debugging: check that we're already owning this lock (or are at a safepoint / handshake)
@@ -1821,6 +1821,9 @@ void os::print_memory_mappings(outputStream* st) {
 }
 
 void os::pretouch_memory(void* start, void* end, size_t page_size) {
+  if (pd_pretouch_memory(start, end, page_size)) {
+    return;
+  }
   for (volatile char *p = (char*)start; p < (char*)end; p += page_size) {
     // Note: this must be a store, not a load. On many OSes loads from fresh
     // memory would be satisfied from a single mapped page containing all zeros.
@@ -158,6 +158,9 @@ class os: AllStatic {
   static bool   pd_unmap_memory(char *addr, size_t bytes);
   static void   pd_free_memory(char *addr, size_t bytes, size_t alignment_hint);
   static void   pd_realign_memory(char *addr, size_t bytes, size_t alignment_hint);
+  // Populate the pages in [start, end) with writable memory, if the OS
+  // can do that without touching each page. Returns false if it cannot.
+  static bool   pd_pretouch_memory(void* start, void* end, size_t page_size);
 
   static char*  pd_reserve_memory_special(size_t size, size_t alignment, size_t page_size,
 
@@ -40,6 +40,7 @@
 #include "gc/shared/workgroup.hpp"
 #include "interpreter/interpreter.hpp"
 #include "jfr/jfrEvents.hpp"
+#include "jfr/support/jfrThreadId.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "memory/resourceArea.hpp"
@@ -93,12 +94,14 @@ static void post_safepoint_synchronize_event(EventSafepointStateSynchronization&
                                              uint64_t safepoint_id,
                                              int initial_number_of_threads,
                                              int threads_waiting_to_block,
-                                             uint64_t iterations) {
+                                             uint64_t iterations,
+                                             JavaThread* last_thread) {
   if (event.should_commit()) {
     event.set_safepointId(safepoint_id);
     event.set_initialThreadCount(initial_number_of_threads);
     event.set_runningThreadCount(threads_waiting_to_block);
     event.set_iterations(iterations);
+    event.set_lastThread(last_thread != NULL ? JFR_THREAD_ID(last_thread) : 0);
     event.commit();
   }
 }
@@ -205,7 +208,8 @@ static void back_off(int64_t start_time) {
   }
 }
 
-int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int nof_threads, int* initial_running)
+int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int nof_threads, int* initial_running,
+                                              JavaThread** last_thread)
 {
   JavaThreadIteratorWithHandle jtiwh;
 
@@ -235,6 +239,7 @@ int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int no
   DEBUG_ONLY(assert_list_is_valid(tss_head, still_running);)
 
   *initial_running = still_running;
+  *last_thread = NULL;
 
   // If there is no thread still running, we are already done.
   if (still_running <= 0) {
@@ -257,6 +262,10 @@ int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int no
       assert(cur_tss->is_running(), "Illegal initial state");
       if (thread_not_running(cur_tss)) {
         --still_running;
+        if (still_running == 0) {
+          // This thread held up the safepoint the longest.
+          *last_thread = cur_tss->thread();
+        }
         *p_prev = NULL;
         ThreadSafepointState *tmp = cur_tss;
         cur_tss = cur_tss->get_next();
@@ -372,14 +381,19 @@ void SafepointSynchronize::begin() {
 
   EventSafepointStateSynchronization sync_event;
   int initial_running = 0;
+  JavaThread* last_thread = NULL;
 
   // Arms the safepoint, _current_jni_active_count and _waiting_to_block must be set before.
   arm_safepoint();
 
   // Will spin until all threads are safe.
-  int iterations = synchronize_threads(safepoint_limit_time, nof_threads, &initial_running);
+  int iterations = synchronize_threads(safepoint_limit_time, nof_threads, &initial_running, &last_thread);
   assert(_waiting_to_block == 0, "No thread should be running");
 
+  if (last_thread != NULL) {
+    log_last_thread(last_thread);
+  }
+
 #ifndef PRODUCT
   // Mark all threads
   if (VerifyCrossModifyFence) {
@@ -422,7 +436,7 @@ void SafepointSynchronize::begin() {
   post_safepoint_synchronize_event(sync_event,
                                    _safepoint_id,
                                    initial_running,
-                                   _waiting_to_block, iterations);
+                                   _waiting_to_block, iterations, last_thread);
 
   SafepointTracing::synchronized(nof_threads, initial_running, _nof_threads_hit_polling_page);
 
@@ -436,6 +450,31 @@ void SafepointSynchronize::begin() {
   SafepointTracing::cleanup();
 }
 
+// Log the thread that was last to reach the safepoint, and where it
+// stopped, to help find code that runs long without a safepoint poll.
+void SafepointSynchronize::log_last_thread(JavaThread* thread) {
+  LogTarget(Debug, safepoint) lt;
+  if (!lt.is_enabled()) {
+    return;
+  }
+  ResourceMark rm;
+  LogStream ls(lt);
+  jlong waited = os::javaTimeNanos() - SafepointTracing::start_of_safepoint();
+  ls.print("Last thread to reach safepoint: \"%s\" after " JLONG_FORMAT " ns",
+           thread->name(), waited);
+  if (thread->has_last_Java_frame()) {
+    frame fr = thread->last_frame();
+    CodeBlob* cb = CodeCache::find_blob_unsafe(fr.pc());
+    if (cb != NULL && cb->is_nmethod()) {
+      ls.print(", in %s at " INTPTR_FORMAT,
+               cb->as_nmethod()->method()->name_and_sig_as_C_string(), p2i(fr.pc()));
+    } else if (cb != NULL) {
+      ls.print(", in %s at " INTPTR_FORMAT, cb->name(), p2i(fr.pc()));
+    }
+  }
+  ls.cr();
+}
+
 void SafepointSynchronize::disarm_safepoint() {
   uint64_t active_safepoint_counter = _safepoint_counter;
   {
@@ -115,7 +115,9 @@ class SafepointSynchronize : AllStatic {
 
   // Helper methods for safepoint procedure:
   static void arm_safepoint();
-  static int synchronize_threads(jlong safepoint_limit_time, int nof_threads, int* initial_running);
+  static int synchronize_threads(jlong safepoint_limit_time, int nof_threads, int* initial_running,
+                                 JavaThread** last_thread);
+  static void log_last_thread(JavaThread* thread);
   static void disarm_safepoint();
   static void increment_jni_active_count();
   static void decrement_waiting_to_block();
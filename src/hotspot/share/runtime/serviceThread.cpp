@@ -32,6 +32,7 @@
 #include "classfile/vmClasses.hpp"
 #include "gc/shared/oopStorage.hpp"
 #include "gc/shared/oopStorageSet.hpp"
+#include "logging/log.hpp"
 #include "memory/universe.hpp"
 #include "oops/oopHandle.inline.hpp"
 #include "runtime/handles.inline.hpp"
@@ -149,6 +150,7 @@ void ServiceThread::service_thread_entry(JavaThread* jt, TRAPS) {
     bool oop_handles_to_release = false;
     bool cldg_cleanup_work = false;
     bool jvmti_tagmap_work = false;
+    bool native_heap_trim_work = false;
     {
       // Need state transition ThreadBlockInVM so that this thread
       // will be handled by safepoint correctly when this thread is
@@ -177,10 +179,12 @@ void ServiceThread::service_thread_entry(JavaThread* jt, TRAPS) {
               (oopstorage_work = OopStorage::has_cleanup_work_and_reset()) |
               (oop_handles_to_release = (_oop_handle_list != NULL)) |
               (cldg_cleanup_work = ClassLoaderDataGraph::should_clean_metaspaces_and_reset()) |
-              (jvmti_tagmap_work = JvmtiTagMap::has_object_free_events_and_reset())
+              (jvmti_tagmap_work = JvmtiTagMap::has_object_free_events_and_reset()) |
+              (native_heap_trim_work = LINUX_ONLY(os::Linux::should_trim_native_heap()) NOT_LINUX(false))
              ) == 0) {
-        // Wait until notified that there is some work to do.
-        ml.wait();
+        // Wait until notified that there is some work to do, or until the
+        // next periodic native heap trim is due.
+        ml.wait(LINUX_ONLY(TrimNativeHeapInterval) NOT_LINUX(0));
       }
 
       if (has_jvmti_events) {
@@ -244,6 +248,22 @@ void ServiceThread::service_thread_entry(JavaThread* jt, TRAPS) {
     if (jvmti_tagmap_work) {
       JvmtiTagMap::flush_all_object_free_events();
     }
+
+#ifdef LINUX
+    if (native_heap_trim_work) {
+      size_t rss_before, rss_after;
+      bool trimmed;
+      {
+        // malloc_trim can take a while on large heaps; do not hold up safepoints.
+        ThreadToNativeFromVM ttn(jt);
+        trimmed = os::Linux::trim_native_heap(&rss_before, &rss_after);
+      }
+      if (trimmed) {
+        log_debug(os)("Native heap trimmed: RSS " SIZE_FORMAT "K -> " SIZE_FORMAT "K",
+                      rss_before / K, rss_after / K);
+      }
+    }
+#endif // LINUX
   }
 }
 
@@ -665,6 +665,8 @@ void NMethodSweeper::print(outputStream* out) {
   out->print_cr("Code cache sweeper statistics:");
   out->print_cr("  Total sweep time:                %1.0lf ms", (double)_total_time_sweeping.value()/1000000);
   out->print_cr("  Total number of full sweeps:     %ld", _total_nof_code_cache_sweeps);
+  out->print_cr("  Peak full sweep time:            %1.0lf ms", (double)_peak_sweep_time.value()/1000000);
+  out->print_cr("  Peak sweep fraction time:        %1.0lf ms", (double)_peak_sweep_fraction_time.value()/1000000);
   out->print_cr("  Total number of flushed methods: %ld (thereof %ld C2 methods)", _total_nof_methods_reclaimed,
                                                     _total_nof_c2_methods_reclaimed);
   out->print_cr("  Total size of flushed methods:   " SIZE_FORMAT " kB", _total_flushed_size/K);
@@ -32,6 +32,7 @@
 #include "code/codeCache.hpp"
 #include "compiler/compileBroker.hpp"
 #include "compiler/directivesParser.hpp"
+#include "compiler/hotMethodList.hpp"
 #include "gc/shared/gcVMOperations.hpp"
 #include "memory/metaspace/metaspaceDCmd.hpp"
 #include "memory/resourceArea.hpp"
@@ -45,7 +46,9 @@
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/javaCalls.hpp"
 #include "runtime/jniHandles.hpp"
+#include "runtime/mutexLocker.hpp"
 #include "runtime/os.hpp"
+#include "runtime/perfData.inline.hpp"
 #include "runtime/vmOperations.hpp"
 #include "runtime/vm_version.hpp"
 #include "services/diagnosticArgument.hpp"
@@ -88,6 +91,8 @@ void DCmdRegistrant::register_dcmds(){
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<PrintVMFlagsDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<SetVMFlagDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<VMDynamicLibrariesDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<PerfCountersDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<LockStatsDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<VMUptimeDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<VMInfoDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<SystemGCDCmd>(full_export, true, false));
@@ -118,8 +123,11 @@ void DCmdRegistrant::register_dcmds(){
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<CodeCacheDCmd>(full_export, true, false));
 #ifdef LINUX
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<PerfMapDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<TrimNativeHeapDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<NativeHeapInfoDCmd>(full_export, true, false));
 #endif // LINUX
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<TouchedMethodsDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<HotMethodListDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<CodeHeapAnalyticsDCmd>(full_export, true, false));
 
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<CompilerDirectivesPrintDCmd>(full_export, true, false));
@@ -807,6 +815,32 @@ void VMDynamicLibrariesDCmd::execute(DCmdSource source, TRAPS) {
   output()->cr();
 }
 
+void PerfCountersDCmd::execute(DCmdSource source, TRAPS) {
+  if (!UsePerfData) {
+    output()->print_cr("PerfData is disabled (-XX:-UsePerfData).");
+    return;
+  }
+  PerfDataList* list = PerfDataManager::all();
+  if (list == NULL) {
+    return;
+  }
+  ResourceMark rm(THREAD);
+  int buflen = (int)PerfMaxStringConstLength + 1;
+  char* buf = NEW_RESOURCE_ARRAY(char, buflen);
+  for (int i = 0; i < list->length(); i++) {
+    PerfData* p = list->at(i);
+    if (p->is_valid()) {
+      p->format(buf, buflen);
+      output()->print_cr("%s=%s", p->name(), buf);
+    }
+  }
+  delete list;
+}
+
+void LockStatsDCmd::execute(DCmdSource source, TRAPS) {
+  print_lock_stats(output());
+}
+
 void CompileQueueDCmd::execute(DCmdSource source, TRAPS) {
   VM_PrintCompileQueue printCompileQueueOp(output());
   VMThread::execute(&printCompileQueueOp);
@@ -824,9 +858,47 @@ void CodeCacheDCmd::execute(DCmdSource source, TRAPS) {
 void PerfMapDCmd::execute(DCmdSource source, TRAPS) {
   CodeCache::write_perf_map();
 }
+
+void TrimNativeHeapDCmd::execute(DCmdSource source, TRAPS) {
+  size_t rss_before, rss_after;
+  bool trimmed;
+  {
+    ThreadToNativeFromVM ttn(THREAD);
+    trimmed = os::Linux::trim_native_heap(&rss_before, &rss_after);
+  }
+  if (trimmed) {
+    output()->print_cr("RSS before: " SIZE_FORMAT "K, after: " SIZE_FORMAT "K",
+                       rss_before / K, rss_after / K);
+  } else {
+    output()->print_cr("Not available.");
+  }
+}
+
+void NativeHeapInfoDCmd::execute(DCmdSource source, TRAPS) {
+  if (!os::Linux::print_native_heap_info(output())) {
+    output()->print_cr("Not available.");
+  }
+}
 #endif // LINUX
 
 //---<  BEGIN  >--- CodeHeap State Analytics.
+HotMethodListDCmd::HotMethodListDCmd(outputStream* output, bool heap) :
+                                     DCmdWithParser(output, heap),
+  _filename("filename", "Name of the file to write the list to. If omitted, the list is printed.", "STRING", false) {
+  _dcmdparser.add_dcmd_argument(&_filename);
+}
+
+void HotMethodListDCmd::execute(DCmdSource source, TRAPS) {
+  const char* path = _filename.value();
+  if (path == NULL) {
+    HotMethodList::dump(output());
+  } else if (HotMethodList::dump_to_file(path)) {
+    output()->print_cr("Hot method list written to %s", path);
+  } else {
+    output()->print_cr("Cannot open hot method list file %s", path);
+  }
+}
+
 CodeHeapAnalyticsDCmd::CodeHeapAnalyticsDCmd(outputStream* output, bool heap) :
                                              DCmdWithParser(output, heap),
   _function("function", "Function to be performed (aggregate, UsedSpace, FreeSpace, MethodCount, MethodSpace, MethodAge, MethodNames, discard", "STRING", false, "all"),
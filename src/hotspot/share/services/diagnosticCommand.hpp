@@ -212,6 +212,49 @@ public:
   virtual void execute(DCmdSource source, TRAPS);
 };
 
+// Prints the PerfData counters from inside the VM. Unlike the jcmd
+// PerfCounter.print command, which reads the hsperfdata file, this also
+// works with -XX:+PerfDisableSharedMem.
+class PerfCountersDCmd : public DCmd {
+public:
+  PerfCountersDCmd(outputStream* output, bool heap) : DCmd(output, heap) {}
+  static const char* name() {
+    return "VM.perf_counters";
+  }
+  static const char* description() {
+    return "Print the current values of all PerfData counters.";
+  }
+  static const char* impact() {
+    return "Low";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "monitor", NULL};
+    return p;
+  }
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
+class LockStatsDCmd : public DCmd {
+public:
+  LockStatsDCmd(outputStream* output, bool heap) : DCmd(output, heap) {}
+  static const char* name() {
+    return "VM.lock_stats";
+  }
+  static const char* description() {
+    return "Print contention statistics of internal VM locks.";
+  }
+  static const char* impact() {
+    return "Low";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "monitor", NULL};
+    return p;
+  }
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
 class VMUptimeDCmd : public DCmdWithParser {
 protected:
   DCmdArgument<bool> _date;
@@ -598,6 +641,46 @@ public:
   }
   virtual void execute(DCmdSource source, TRAPS);
 };
+
+class TrimNativeHeapDCmd : public DCmd {
+public:
+  TrimNativeHeapDCmd(outputStream* output, bool heap) : DCmd(output, heap) {}
+  static const char* name() {
+    return "System.trim_native_heap";
+  }
+  static const char* description() {
+    return "Attempt to free up memory by trimming the C-heap.";
+  }
+  static const char* impact() {
+    return "Low";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "control", NULL};
+    return p;
+  }
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
+class NativeHeapInfoDCmd : public DCmd {
+public:
+  NativeHeapInfoDCmd(outputStream* output, bool heap) : DCmd(output, heap) {}
+  static const char* name() {
+    return "System.native_heap_info";
+  }
+  static const char* description() {
+    return "Print C-heap statistics, including per-arena usage.";
+  }
+  static const char* impact() {
+    return "Low";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "monitor", NULL};
+    return p;
+  }
+  virtual void execute(DCmdSource source, TRAPS);
+};
 #endif // LINUX
 
 class CodeListDCmd : public DCmd {
@@ -640,6 +723,29 @@ public:
   virtual void execute(DCmdSource source, TRAPS);
 };
 
+class HotMethodListDCmd : public DCmdWithParser {
+protected:
+  DCmdArgument<char*> _filename;
+public:
+  HotMethodListDCmd(outputStream* output, bool heap);
+  static const char* name() {
+    return "Compiler.hot_methods";
+  }
+  static const char* description() {
+    return "Print the methods compiled by C2 in the format read by -XX:HotMethodListFile, "
+           "or write them to a file.";
+  }
+  static const char* impact() {
+    return "Medium: Depends on the number of loaded methods.";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "monitor", NULL};
+    return p;
+  }
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
 //---<  BEGIN  >--- CodeHeap State Analytics.
 class CodeHeapAnalyticsDCmd : public DCmdWithParser {
 protected:
@@ -28,6 +28,7 @@
 #include "services/mallocTracker.inline.hpp"
 #include "services/memTracker.hpp"
 
+ATTRIBUTE_ALIGNED(DEFAULT_CACHE_LINE_SIZE)
 size_t MallocMemorySummary::_snapshot[CALC_OBJ_SIZE_IN_TYPE(MallocMemorySnapshot, size_t)];
 
 #ifdef ASSERT
@@ -28,6 +28,7 @@
 #if INCLUDE_NMT
 
 #include "memory/allocation.hpp"
+#include "memory/padded.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/threadCritical.hpp"
 #include "services/nmtCommon.hpp"
@@ -93,11 +94,17 @@ class MemoryCounter {
  * Malloc memory used by a particular subsystem.
  * It includes the memory acquired through os::malloc()
  * call and arena's backing memory.
+ *
+ * The counters are updated on every malloc and free, so each one gets a
+ * cache line to itself, instead of sharing it with the counters of the
+ * neighbouring memory types.
  */
 class MallocMemory {
  private:
   MemoryCounter _malloc;
+  DEFINE_PAD_MINUS_SIZE(0, DEFAULT_CACHE_LINE_SIZE, sizeof(MemoryCounter));
   MemoryCounter _arena;
+  DEFINE_PAD_MINUS_SIZE(1, DEFAULT_CACHE_LINE_SIZE, sizeof(MemoryCounter));
 
  public:
   MallocMemory() { }
@@ -139,7 +146,8 @@ class MallocMemorySnapshot : public ResourceObj {
   friend class MallocMemorySummary;
 
  private:
-  MallocMemory      _malloc[mt_number_of_types];
+  // Cache line aligned, see MallocMemory. ResourceObj has fields in debug builds.
+  ATTRIBUTE_ALIGNED(DEFAULT_CACHE_LINE_SIZE) MallocMemory _malloc[mt_number_of_types];
   MemoryCounter     _tracking_header;
 
 
@@ -184,7 +192,8 @@ class MallocMemorySnapshot : public ResourceObj {
  */
 class MallocMemorySummary : AllStatic {
  private:
-  // Reserve memory for placement of MallocMemorySnapshot object
+  // Reserve memory for placement of MallocMemorySnapshot object, cache line
+  // aligned so that the padded counters do not straddle cache lines
   static size_t _snapshot[CALC_OBJ_SIZE_IN_TYPE(MallocMemorySnapshot, size_t)];
 
  public:
@@ -212,6 +212,13 @@ inline BitMap::idx_t BitMap::get_next_bit_impl(idx_t l_index, idx_t r_index) con
       idx_t limit = aligned_right
         ? to_words_align_down(r_index) // Miniscule savings when aligned.
         : to_words_align_up(r_index);
+      // Skip pairs of uninteresting words with a single test.  Sparse
+      // bitmaps, such as mark bitmaps of mostly dead regions, spend most
+      // of their search time in this loop.
+      while ((index + 2 < limit) &&
+             (((map(index + 1) ^ flip) | (map(index + 2) ^ flip)) == 0)) {
+        index += 2;
+      }
       while (++index < limit) {
         cword = map(index) ^ flip;
         if (cword != 0) {
@@ -302,6 +302,14 @@ class Copy : AllStatic {
     pd_zero_to_words(to, count);
   }
 
+  // Zero word-aligned words, not atomic on each word. Large spans may
+  // bypass the caches, so only use this for memory that is not read
+  // back soon.
+  static void zero_to_words_nontemporal(HeapWord* to, size_t count) {
+    assert_params_ok(to, HeapWordSize);
+    pd_zero_to_words_nontemporal(to, count);
+  }
+
   // Zero bytes
   static void zero_to_bytes(void* to, size_t count) {
     pd_zero_to_bytes(to, count);
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/g1/g1CardTable.hpp"
+#include "gc/g1/g1CardTableScanner.hpp"
+#include "runtime/os.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "unittest.hpp"
+
+typedef CardTable::CardValue CardValue;
+
+static const size_t NumCards = 256;
+
+class G1CardTableScannerTest : public ::testing::Test {
+protected:
+  ATTRIBUTE_ALIGNED(BytesPerWord) CardValue _cards[NumCards];
+
+  void fill(CardValue value) {
+    for (size_t i = 0; i < NumCards; i++) {
+      _cards[i] = value;
+    }
+  }
+
+  void set_range(size_t from, size_t to, CardValue value) {
+    for (size_t i = from; i < to; i++) {
+      _cards[i] = value;
+    }
+  }
+
+  static bool is_dirty(CardValue value) {
+    return (value & G1CardTable::g1_scanned_card_val()) == 0;
+  }
+
+  // Walks the cards one by one and compares every dirty run against what
+  // the scanner reports, using the same call sequence as G1RemSet.
+  void verify(size_t start, size_t size) {
+    G1CardTableScanner scan(&_cards[start], size);
+
+    size_t expected_idx = 0;
+    size_t first = scan.find_next_dirty();
+    while (true) {
+      while (expected_idx < size && !is_dirty(_cards[start + expected_idx])) {
+        expected_idx++;
+      }
+      ASSERT_EQ(expected_idx, first) << "dirty run start, region start " << start;
+      if (first == size) {
+        break;
+      }
+
+      size_t last = scan.find_next_non_dirty();
+      while (expected_idx < size && is_dirty(_cards[start + expected_idx])) {
+        expected_idx++;
+      }
+      ASSERT_EQ(expected_idx, last) << "dirty run end, region start " << start;
+      if (last == size) {
+        break;
+      }
+      first = scan.find_next_dirty();
+    }
+  }
+
+  void verify_all() {
+    verify(0, NumCards);
+    verify(sizeof(size_t), NumCards - sizeof(size_t));
+    verify(0, 2 * sizeof(size_t));
+  }
+};
+
+TEST_F(G1CardTableScannerTest, all_clean) {
+  fill(G1CardTable::clean_card_val());
+  G1CardTableScanner scan(_cards, NumCards);
+  ASSERT_EQ(NumCards, scan.find_next_dirty());
+}
+
+TEST_F(G1CardTableScannerTest, all_dirty) {
+  fill(G1CardTable::dirty_card_val());
+  G1CardTableScanner scan(_cards, NumCards);
+  ASSERT_EQ(0u, scan.find_next_dirty());
+  ASSERT_EQ(NumCards, scan.find_next_non_dirty());
+}
+
+TEST_F(G1CardTableScannerTest, already_scanned_is_not_dirty) {
+  fill(G1CardTable::g1_scanned_card_val());
+  set_range(100, 103, G1CardTable::dirty_card_val());
+  G1CardTableScanner scan(_cards, NumCards);
+  ASSERT_EQ(100u, scan.find_next_dirty());
+  ASSERT_EQ(103u, scan.find_next_non_dirty());
+  ASSERT_EQ(NumCards, scan.find_next_dirty());
+}
+
+TEST_F(G1CardTableScannerTest, single_cards) {
+  // A single dirty card at every position, including word boundaries, the
+  // unrolled multi-word skip and the very last card.
+  for (size_t i = 0; i < NumCards; i++) {
+    fill(G1CardTable::clean_card_val());
+    _cards[i] = G1CardTable::dirty_card_val();
+    verify_all();
+  }
+}
+
+TEST_F(G1CardTableScannerTest, runs) {
+  fill(G1CardTable::clean_card_val());
+  set_range(3, 5, G1CardTable::dirty_card_val());      // Within the first word.
+  set_range(7, 9, G1CardTable::dirty_card_val());      // Across a word boundary.
+  set_range(40, 41, G1CardTable::g1_scanned_card_val());
+  set_range(70, 140, G1CardTable::dirty_card_val());   // Spans several unrolled blocks.
+  set_range(NumCards - 1, NumCards, G1CardTable::dirty_card_val());
+  verify_all();
+}
+
+TEST_F(G1CardTableScannerTest, random) {
+  const CardValue values[] = { G1CardTable::clean_card_val(),
+                               G1CardTable::dirty_card_val(),
+                               G1CardTable::g1_scanned_card_val() };
+  for (uint iter = 0; iter < 100; iter++) {
+    // Bias towards long runs of the same value to exercise the word-wise paths.
+    CardValue value = values[os::random() % ARRAY_SIZE(values)];
+    for (size_t i = 0; i < NumCards; i++) {
+      if (os::random() % 16 == 0) {
+        value = values[os::random() % ARRAY_SIZE(values)];
+      }
+      _cards[i] = value;
+    }
+    verify_all();
+  }
+}
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary C2CompileNodeBudget makes C2 skip loop opts and records an
+ *          over_budget element in the compilation log, and the compiled
+ *          code still computes the right result.
+ * @requires vm.compiler2.enabled & vm.flagless
+ * @library /test/lib
+ * @run driver compiler.c2.TestCompileNodeBudget
+ */
+
+package compiler.c2;
+
+import java.nio.file.Files;
+import java.nio.file.Path;
+
+import jdk.test.lib.Asserts;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestCompileNodeBudget {
+
+    public static class Worker {
+        static int sum(int[] a) {
+            int s = 0;
+            for (int i = 0; i < a.length; i++) {
+                s += a[i] * 3;
+            }
+            return s;
+        }
+
+        public static void main(String[] args) {
+            int[] a = new int[1000];
+            for (int i = 0; i < a.length; i++) {
+                a[i] = i;
+            }
+            for (int i = 0; i < 20_000; i++) {
+                if (sum(a) != 3 * 999 * 1000 / 2) {
+                    throw new RuntimeException("wrong result");
+                }
+            }
+        }
+    }
+
+    private static String run(String budget) throws Exception {
+        Path log = Path.of("node_budget_" + budget + ".log");
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+            "-Xbatch",
+            "-XX:-TieredCompilation",
+            "-XX:CompileCommand=compileonly," + Worker.class.getName() + "::sum",
+            "-XX:C2CompileNodeBudget=" + budget,
+            "-XX:+UnlockDiagnosticVMOptions",
+            "-XX:+LogCompilation",
+            "-XX:LogFile=" + log,
+            Worker.class.getName());
+        new OutputAnalyzer(pb.start()).shouldHaveExitValue(0);
+        return Files.readString(log);
+    }
+
+    public static void main(String[] args) throws Exception {
+        // Any compile has more than one live node, so a budget of 1 always
+        // triggers, and the method must still get an nmethod.
+        String log = run("1");
+        Asserts.assertTrue(log.contains("<over_budget reason='nodes'"), "over_budget element missing");
+        Asserts.assertTrue(log.contains("<nmethod"), "method was not compiled");
+
+        // Without a budget, C2 never reports over_budget.
+        log = run("0");
+        Asserts.assertFalse(log.contains("<over_budget"), "unexpected over_budget element");
+    }
+}
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package compiler.c2.irTests;
+
+import compiler.lib.ir_framework.*;
+import jdk.test.lib.Asserts;
+
+/*
+ * @test
+ * @summary Field loads from a Phi merging new objects of the same klass are
+ *          split through the Phi, so that the merged allocations can be
+ *          scalar replaced.
+ * @requires vm.compiler2.enabled
+ * @library /test/lib /
+ * @run driver compiler.c2.irTests.TestReduceAllocationMerges
+ */
+public class TestReduceAllocationMerges {
+
+    static class Point {
+        int x, y;
+        Point(int x, int y) {
+            this.x = x;
+            this.y = y;
+        }
+    }
+
+    static class Point3 extends Point {
+        int z;
+        Point3(int x, int y, int z) {
+            super(x, y);
+            this.z = z;
+        }
+    }
+
+    static Point sink;
+
+    public static void main(String[] args) {
+        TestFramework.runWithFlags("-XX:+UnlockDiagnosticVMOptions", "-XX:+ReduceAllocationMerges");
+    }
+
+    // Both allocations have the same klass and the merge is only used by
+    // field loads, so both are scalar replaced.
+    @Test
+    @IR(failOn = IRNode.ALLOC)
+    static int testMerge(boolean c, int a, int b) {
+        Point p = c ? new Point(a, b) : new Point(b, a);
+        return p.x * 31 + p.y;
+    }
+
+    @Run(test = "testMerge")
+    public void runMerge() {
+        Asserts.assertEQ(testMerge(true, 3, 7), 3 * 31 + 7);
+        Asserts.assertEQ(testMerge(false, 3, 7), 7 * 31 + 3);
+    }
+
+    // Merges of different klasses are not split.
+    @Test
+    @IR(counts = {IRNode.ALLOC, "2"})
+    static int testDifferentKlass(boolean c, int a, int b) {
+        Point p = c ? new Point(a, b) : new Point3(b, a, a + b);
+        return p.x * 31 + p.y;
+    }
+
+    @Run(test = "testDifferentKlass")
+    public void runDifferentKlass() {
+        Asserts.assertEQ(testDifferentKlass(true, 3, 7), 3 * 31 + 7);
+        Asserts.assertEQ(testDifferentKlass(false, 3, 7), 7 * 31 + 3);
+    }
+
+    // An escaping input must stay allocated. The other input can still be
+    // scalar replaced.
+    @Test
+    @IR(counts = {IRNode.ALLOC, "1"})
+    static int testEscapingInput(boolean c, int a, int b) {
+        Point p;
+        if (c) {
+            p = new Point(a, b);
+            sink = p;
+        } else {
+            p = new Point(b, a);
+        }
+        return p.x * 31 + p.y;
+    }
+
+    @Run(test = "testEscapingInput")
+    public void runEscapingInput() {
+        sink = null;
+        Asserts.assertEQ(testEscapingInput(true, 3, 7), 3 * 31 + 7);
+        Asserts.assertNotNull(sink);
+        Asserts.assertEQ(sink.x, 3);
+        Asserts.assertEQ(sink.y, 7);
+        Asserts.assertEQ(testEscapingInput(false, 3, 7), 7 * 31 + 3);
+    }
+
+    // The merge is live in the uncommon trap of the rarely taken branch.
+    // After the trap is hit, the interpreter must see the right object.
+    @Test
+    static int testDeopt(boolean c, int a, int b) {
+        Point p = c ? new Point(a, b) : new Point(b, a);
+        if (a == Integer.MIN_VALUE) {
+            sink = p;
+            return p.y;
+        }
+        return p.x * 31 + p.y;
+    }
+
+    @Run(test = "testDeopt")
+    public void runDeopt(RunInfo info) {
+        Asserts.assertEQ(testDeopt(true, 3, 7), 3 * 31 + 7);
+        Asserts.assertEQ(testDeopt(false, 3, 7), 7 * 31 + 3);
+        if (!info.isWarmUp()) {
+            sink = null;
+            Asserts.assertEQ(testDeopt(true, Integer.MIN_VALUE, 7), 7);
+            Asserts.assertEQ(sink.x, Integer.MIN_VALUE);
+            Asserts.assertEQ(testDeopt(false, Integer.MIN_VALUE, 7), Integer.MIN_VALUE);
+            Asserts.assertEQ(sink.x, 7);
+        }
+    }
+}
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package compiler.inlining;
+
+import compiler.lib.ir_framework.*;
+import jdk.test.lib.Asserts;
+
+/*
+ * @test
+ * @summary With PolymorphicInliningLimit and TypeProfileWidth raised, C2
+ *          inlines a call site with four receiver types behind a cascade of
+ *          type checks. With the defaults the site keeps a virtual call.
+ * @requires vm.compiler2.enabled
+ * @library /test/lib /
+ * @run driver compiler.inlining.TestPolymorphicInlining
+ */
+public class TestPolymorphicInlining {
+
+    private static final String CALL_DYNAMIC = IRNode.START + "CallDynamicJava" + IRNode.MID + IRNode.END;
+
+    static abstract class Shape {
+        abstract int area();
+    }
+
+    static class Square extends Shape {
+        int area() { return 4; }
+    }
+
+    static class Rect extends Shape {
+        int area() { return 6; }
+    }
+
+    static class Triangle extends Shape {
+        int area() { return 3; }
+    }
+
+    static class Circle extends Shape {
+        int area() { return 12; }
+    }
+
+    // Not seen while profiling, only used after compilation.
+    static class Hexagon extends Shape {
+        int area() { return 24; }
+    }
+
+    private static final Shape[] SHAPES = {
+        // Receiver frequencies are skewed, so the cascade order matters.
+        new Square(), new Square(), new Square(), new Square(),
+        new Rect(), new Rect(), new Rect(),
+        new Triangle(), new Triangle(),
+        new Circle()
+    };
+    private static final int SHAPES_AREA = 4 * 4 + 3 * 6 + 2 * 3 + 12;
+
+    public static void main(String[] args) {
+        TestFramework framework = new TestFramework();
+        framework.addScenarios(new Scenario(0, "-XX:TypeProfileWidth=4", "-XX:PolymorphicInliningLimit=4"),
+                               new Scenario(1));
+        framework.start();
+    }
+
+    @Test
+    @IR(applyIf = {"PolymorphicInliningLimit", "4"}, failOn = CALL_DYNAMIC)
+    @IR(applyIf = {"PolymorphicInliningLimit", "2"}, counts = {CALL_DYNAMIC, ">= 1"})
+    static int totalArea(Shape[] shapes) {
+        int sum = 0;
+        for (Shape s : shapes) {
+            sum += s.area();
+        }
+        return sum;
+    }
+
+    @Run(test = "totalArea")
+    public void runTotalArea(RunInfo info) {
+        Asserts.assertEQ(totalArea(SHAPES), SHAPES_AREA);
+        if (!info.isWarmUp()) {
+            // A receiver type without a check must still be dispatched correctly,
+            // through the uncommon trap at the end of the cascade.
+            Shape[] more = { new Square(), new Hexagon(), new Circle() };
+            Asserts.assertEQ(totalArea(more), 4 + 24 + 12);
+        }
+    }
+}
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package compiler.loopopts.superword;
+
+import compiler.lib.ir_framework.*;
+import jdk.test.lib.Asserts;
+
+/*
+ * @test
+ * @summary SuperWord vectorizes int reductions over byte and short operands
+ *          by widening the operand vector before the reduction.
+ * @requires vm.compiler2.enabled
+ * @requires (os.arch == "amd64" | os.arch == "x86_64") & vm.cpu.features ~= ".*avx2.*"
+ * @library /test/lib /
+ * @run driver compiler.loopopts.superword.TestWideningReduction
+ */
+public class TestWideningReduction {
+
+    private static final int LENGTH = 1024;
+
+    private static final String ADD_REDUCTION_VI = IRNode.START + "AddReductionVI" + IRNode.MID + IRNode.END;
+    private static final String VECTOR_CAST_B2X = IRNode.START + "VectorCastB2X" + IRNode.MID + IRNode.END;
+    private static final String VECTOR_CAST_S2X = IRNode.START + "VectorCastS2X" + IRNode.MID + IRNode.END;
+
+    private static final byte[] bytes = new byte[LENGTH];
+    private static final short[] shorts = new short[LENGTH];
+
+    static {
+        for (int i = 0; i < LENGTH; i++) {
+            bytes[i] = (byte)(i * 7);
+            shorts[i] = (short)(i * 1031);
+        }
+    }
+
+    public static void main(String[] args) {
+        TestFramework.run();
+    }
+
+    @Test
+    @IR(counts = {ADD_REDUCTION_VI, ">= 1", VECTOR_CAST_B2X, ">= 1"})
+    static int sumBytes(byte[] a) {
+        int sum = 0;
+        for (int i = 0; i < a.length; i++) {
+            sum += a[i];
+        }
+        return sum;
+    }
+
+    @Run(test = "sumBytes")
+    public void runSumBytes() {
+        int expected = 0;
+        for (int i = 0; i < LENGTH; i++) {
+            expected += bytes[i];
+        }
+        Asserts.assertEQ(sumBytes(bytes), expected);
+    }
+
+    @Test
+    @IR(counts = {ADD_REDUCTION_VI, ">= 1", VECTOR_CAST_S2X, ">= 1"})
+    static int sumShorts(short[] a) {
+        int sum = 0;
+        for (int i = 0; i < a.length; i++) {
+            sum += a[i];
+        }
+        return sum;
+    }
+
+    @Run(test = "sumShorts")
+    public void runSumShorts() {
+        int expected = 0;
+        for (int i = 0; i < LENGTH; i++) {
+            expected += shorts[i];
+        }
+        Asserts.assertEQ(sumShorts(shorts), expected);
+    }
+
+    // A long accumulator is not a widening int reduction and must not be
+    // packed as one.
+    @Test
+    @IR(failOn = {VECTOR_CAST_B2X})
+    static long sumBytesToLong(byte[] a) {
+        long sum = 0;
+        for (int i = 0; i < a.length; i++) {
+            sum += a[i];
+        }
+        return sum;
+    }
+
+    @Run(test = "sumBytesToLong")
+    public void runSumBytesToLong() {
+        long expected = 0;
+        for (int i = 0; i < LENGTH; i++) {
+            expected += bytes[i];
+        }
+        Asserts.assertEQ(sumBytesToLong(bytes), expected);
+    }
+}
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Methods compiled by C2 are written to HotMethodListAtExit, and a
+ *          run that reads the list with HotMethodListFile loads them.
+ * @requires vm.compiler2.enabled & vm.flagless
+ * @library /test/lib
+ * @run driver compiler.tiered.TestHotMethodList
+ */
+
+package compiler.tiered;
+
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.List;
+
+import jdk.test.lib.Asserts;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestHotMethodList {
+
+    static final String HOT_METHOD = "compiler/tiered/TestHotMethodList$Worker hot (I)I";
+
+    public static class Worker {
+        static int hot(int i) {
+            int r = 0;
+            for (int j = 0; j < 8; j++) {
+                r += (i ^ j) * 31;
+            }
+            return r;
+        }
+
+        public static void main(String[] args) {
+            int sum = 0;
+            for (int i = 0; i < 1_000_000; i++) {
+                sum += hot(i);
+            }
+            System.out.println("sum " + sum);
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        Path list = Path.of("hot_methods.txt");
+
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:-BackgroundCompilation",
+            "-XX:HotMethodListAtExit=" + list,
+            Worker.class.getName());
+        new OutputAnalyzer(pb.start()).shouldHaveExitValue(0);
+
+        List<String> lines = Files.readAllLines(list);
+        Asserts.assertTrue(lines.contains(HOT_METHOD), HOT_METHOD + " missing from " + lines);
+        for (String line : lines) {
+            Asserts.assertEQ(line.split(" ").length, 3, "Unexpected line: " + line);
+        }
+
+        pb = ProcessTools.createJavaProcessBuilder(
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:HotMethodListFile=" + list,
+            "-Xlog:jit+compilation=info",
+            Worker.class.getName());
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+        output.shouldContain("Loaded " + lines.size() + " hot methods from " + list);
+    }
+}
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package compiler.vectorization;
+
+import compiler.lib.ir_framework.*;
+import jdk.test.lib.Asserts;
+
+/*
+ * @test
+ * @summary With UseMaskedPostLoop the post loop of a vectorized loop runs as one
+ *          masked vector iteration, with one VectorMaskGen shared by all
+ *          memory operations of the same element type.
+ * @requires vm.compiler2.enabled & (os.arch == "amd64" | os.arch == "x86_64")
+ * @requires vm.cpu.features ~= ".*avx512vl.*" & vm.cpu.features ~= ".*avx512bw.*"
+ * @library /test/lib /
+ * @run driver compiler.vectorization.TestMaskedPostLoop
+ */
+public class TestMaskedPostLoop {
+
+    private static final String LOAD_VECTOR_MASKED = IRNode.START + "LoadVectorMasked" + IRNode.MID + IRNode.END;
+    private static final String STORE_VECTOR_MASKED = IRNode.START + "StoreVectorMasked" + IRNode.MID + IRNode.END;
+    private static final String VECTOR_MASK_GEN = IRNode.START + "VectorMaskGen" + IRNode.MID + IRNode.END;
+
+    // Lengths that leave a tail of every size, including the empty one.
+    private static final int[] LENGTHS = {0, 1, 15, 16, 17, 31, 100, 127, 200};
+
+    public static void main(String[] args) {
+        TestFramework.runWithFlags("-XX:+UseMaskedPostLoop", "-XX:UseAVX=3");
+    }
+
+    @Test
+    @IR(counts = {LOAD_VECTOR_MASKED, "2", STORE_VECTOR_MASKED, "1", VECTOR_MASK_GEN, "1"})
+    static void addInts(int[] a, int[] b, int[] c) {
+        for (int i = 0; i < a.length; i++) {
+            c[i] = a[i] + b[i];
+        }
+    }
+
+    @Run(test = "addInts")
+    public void runAddInts() {
+        for (int len : LENGTHS) {
+            int[] a = new int[len];
+            int[] b = new int[len];
+            int[] c = new int[len + 1];
+            for (int i = 0; i < len; i++) {
+                a[i] = i;
+                b[i] = 3 * i;
+            }
+            c[len] = -1;
+            addInts(a, b, c);
+            for (int i = 0; i < len; i++) {
+                Asserts.assertEQ(c[i], 4 * i);
+            }
+            // The masked store must not write past the trip count.
+            Asserts.assertEQ(c[len], -1);
+        }
+    }
+
+    @Test
+    @IR(counts = {LOAD_VECTOR_MASKED, "1", STORE_VECTOR_MASKED, "1", VECTOR_MASK_GEN, "1"})
+    static void scaleBytes(byte[] a, byte[] b) {
+        for (int i = 0; i < a.length; i++) {
+            b[i] = (byte)(a[i] * 3);
+        }
+    }
+
+    @Run(test = "scaleBytes")
+    public void runScaleBytes() {
+        for (int len : LENGTHS) {
+            byte[] a = new byte[len];
+            byte[] b = new byte[len + 1];
+            for (int i = 0; i < len; i++) {
+                a[i] = (byte)i;
+            }
+            b[len] = 42;
+            scaleBytes(a, b);
+            for (int i = 0; i < len; i++) {
+                Asserts.assertEQ(b[i], (byte)(i * 3));
+            }
+            Asserts.assertEQ(b[len], (byte)42);
+        }
+    }
+}
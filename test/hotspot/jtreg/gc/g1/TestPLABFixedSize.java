@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.g1;
+
+/*
+ * @test TestPLABFixedSize
+ * @summary Check that G1 does not resize per-worker PLABs with -XX:-ResizePLAB.
+ * @requires vm.gc.G1
+ * @modules java.base/jdk.internal.misc
+ * @library /test/lib
+ * @build sun.hotspot.WhiteBox
+ * @run driver jdk.test.lib.helpers.ClassFileInstaller sun.hotspot.WhiteBox
+ * @run driver gc.g1.TestPLABFixedSize
+ */
+
+import java.util.ArrayList;
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+import jdk.test.lib.Platform;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+import sun.hotspot.WhiteBox;
+
+import static jdk.test.lib.Asserts.*;
+
+public class TestPLABFixedSize {
+
+    private static final int PLAB_SIZE = 1024; // words
+
+    public static void main(String[] args) throws Exception {
+        final String[] arguments = {
+            "-Xbootclasspath/a:.",
+            "-XX:+UnlockDiagnosticVMOptions",
+            "-XX:+WhiteBoxAPI",
+            "-XX:+UseG1GC",
+            "-Xmx64M",
+            "-XX:ParallelGCThreads=1",
+            "-XX:-ResizePLAB",
+            "-XX:YoungPLABSize=" + PLAB_SIZE,
+            "-XX:OldPLABSize=" + PLAB_SIZE,
+            "-Xlog:gc+plab=trace",
+            GCTest.class.getName()
+            };
+
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(arguments);
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+
+        output.shouldHaveExitValue(0);
+
+        System.out.println(output.getStdout());
+
+        long expected = PLAB_SIZE * (Platform.is64bit() ? 8L : 4L);
+        Pattern r = Pattern.compile("PLAB refills: (\\d+) .*young PLAB size: (\\d+)B old PLAB size: (\\d+)B");
+        Matcher m = r.matcher(output.getStdout());
+
+        int lines = 0;
+        long maxRefills = 0;
+        while (m.find()) {
+            lines++;
+            maxRefills = Math.max(maxRefills, Long.parseLong(m.group(1)));
+            assertEQ(Long.parseLong(m.group(2)), expected, "Young PLAB size changed with -XX:-ResizePLAB");
+            assertEQ(Long.parseLong(m.group(3)), expected, "Old PLAB size changed with -XX:-ResizePLAB");
+        }
+        assertGT(lines, 0, "Could not find any per-worker PLAB output");
+        // Enough refills that the size would have been doubled with ResizePLAB.
+        assertGTE(maxRefills, 8L, "Too few PLAB refills to exercise resizing");
+    }
+
+    static class GCTest {
+        private static final WhiteBox WB = WhiteBox.getWhiteBox();
+
+        public static ArrayList<Object> holder = new ArrayList<>();
+
+        public static void main(String [] args) {
+            // Keep a few MB of small objects alive so that they are copied
+            // through many PLABs.
+            for (int i = 0; i < 100_000; i++) {
+                holder.add(new byte[32]);
+            }
+            WB.youngGC();
+            WB.youngGC();
+            System.out.println(holder.size());
+        }
+    }
+}
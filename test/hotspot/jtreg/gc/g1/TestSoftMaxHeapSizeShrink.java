@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.g1;
+
+/**
+ * @test TestSoftMaxHeapSizeShrink
+ * @requires vm.gc.G1
+ * @summary Lowering SoftMaxHeapSize at run time shrinks the heap at the next
+ *          full GC, but never below the minimum heap size.
+ * @library /test/lib /
+ * @modules java.management
+ * @run main/othervm -XX:+UseG1GC -XX:G1HeapRegionSize=1M -Xms32m -Xmx256m
+ *                   -XX:MinHeapFreeRatio=10 -XX:MaxHeapFreeRatio=100
+ *                   -XX:-ExplicitGCInvokesConcurrent -Xlog:gc+ergo+heap=debug
+ *                   gc.g1.TestSoftMaxHeapSizeShrink
+ */
+
+import com.sun.management.HotSpotDiagnosticMXBean;
+import java.lang.management.ManagementFactory;
+import java.util.ArrayList;
+import java.util.List;
+import static jdk.test.lib.Asserts.*;
+
+public class TestSoftMaxHeapSizeShrink {
+
+    private static final long M = 1024 * 1024;
+    private static final long MIN_HEAP_SIZE = 32 * M;
+    private static final long SOFT_MAX_HEAP_SIZE = 64 * M;
+
+    private static List<byte[]> garbage = new ArrayList<>();
+
+    private static long committed() {
+        return ManagementFactory.getMemoryMXBean().getHeapMemoryUsage().getCommitted();
+    }
+
+    private static void setSoftMaxHeapSize(long value) {
+        HotSpotDiagnosticMXBean diagnostic =
+            ManagementFactory.getPlatformMXBean(HotSpotDiagnosticMXBean.class);
+        diagnostic.setVMOption("SoftMaxHeapSize", Long.toString(value));
+    }
+
+    public static void main(String[] args) {
+        // Grow the heap well above the soft limit.
+        for (int i = 0; i < 160; i++) {
+            garbage.add(new byte[(int) M]);
+        }
+        garbage = null;
+
+        // MaxHeapFreeRatio=100 keeps G1 from shrinking on its own.
+        System.gc();
+        long before = committed();
+        System.out.println("Committed after growing: " + before);
+        assertGreaterThan(before, SOFT_MAX_HEAP_SIZE, "Heap did not grow above the soft limit");
+
+        setSoftMaxHeapSize(SOFT_MAX_HEAP_SIZE);
+        System.gc();
+        long soft = committed();
+        System.out.println("Committed with SoftMaxHeapSize=" + SOFT_MAX_HEAP_SIZE + ": " + soft);
+        assertLessThanOrEqual(soft, SOFT_MAX_HEAP_SIZE, "Heap did not shrink to SoftMaxHeapSize");
+
+        // A soft limit below -Xms must not uncommit below MinHeapSize.
+        setSoftMaxHeapSize(8 * M);
+        System.gc();
+        long min = committed();
+        System.out.println("Committed with SoftMaxHeapSize below -Xms: " + min);
+        assertGreaterThanOrEqual(min, MIN_HEAP_SIZE, "Heap shrank below MinHeapSize");
+    }
+}
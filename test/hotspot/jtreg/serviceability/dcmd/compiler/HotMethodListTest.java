@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+import org.testng.annotations.Test;
+import jdk.test.lib.dcmd.CommandExecutor;
+import jdk.test.lib.dcmd.JMXExecutor;
+import jdk.test.lib.process.OutputAnalyzer;
+
+/*
+ * @test
+ * @summary Test of diagnostic command Compiler.hot_methods
+ * @requires vm.compiler2.enabled
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.compiler
+ *          java.management
+ *          jdk.internal.jvmstat/sun.jvmstat.monitor
+ * @run testng/othervm -XX:-BackgroundCompilation HotMethodListTest
+ */
+public class HotMethodListTest {
+    static int hot(int i) {
+        int r = 0;
+        for (int j = 0; j < 8; j++) {
+            r += (i ^ j) * 31;
+        }
+        return r;
+    }
+
+    public void run(CommandExecutor executor) {
+        int sum = 0;
+        for (int i = 0; i < 1_000_000; i++) {
+            sum += hot(i);
+        }
+        System.out.println("sum " + sum);
+
+        OutputAnalyzer output = executor.execute("Compiler.hot_methods");
+        output.shouldContain("HotMethodListTest hot (I)I");
+        // Every entry has exactly three fields.
+        output.stdoutShouldNotMatch("(?m)^\\S+ \\S+ \\S+ .*$");
+
+        output = executor.execute("Compiler.hot_methods filename=hot_methods.txt");
+        output.shouldContain("Hot method list written to hot_methods.txt");
+    }
+
+    @Test
+    public void jmx() {
+        run(new JMXExecutor());
+    }
+}